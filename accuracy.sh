@@ -0,0 +1,3 @@
+#!/bin/zsh
+
+cd benchmark/build && ./HyperionMathAccuracy "$@"
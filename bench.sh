@@ -0,0 +1,3 @@
+#!/bin/zsh
+
+cd benchmark/build && ./HyperionMathBench --benchmark_out=benchmark_results.json --benchmark_out_format=json "$@"
@@ -0,0 +1,205 @@
+#ifndef __MSC_VER
+	#include <cmath>
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "AccuracySweep.h"
+#include "HyperionMath/Exponentials.h"
+#include "HyperionMath/General.h"
+#include "HyperionMath/Trig.h"
+
+namespace hyperion::math::accuracy {
+
+	/// @brief A function to sweep, with the options it should be swept with
+	struct SweepCase {
+		std::string name;
+		std::function<void(const SweepOptions&)> run;
+	};
+
+	/// @brief Adds a sweep of `approximation` against `reference` to `cases`
+	///
+	/// `float` functions are checked against the `double` standard library function, and
+	/// `double` ones against the `long double` one
+	///
+	/// @param cases - The cases to add the sweep to
+	/// @param name - The name of the function
+	/// @param approximation - The function to sweep, `T(T)`
+	/// @param reference - The reference function, generic over the argument type
+	template<FloatingPoint T, typename Approximation, typename Reference>
+	inline auto add_sweep(std::vector<SweepCase>& cases,
+						  const std::string& name,
+						  Approximation approximation,
+						  Reference reference) -> void {
+		using Precise = std::conditional_t<std::is_same_v<T, float>, double, long double>;
+		const auto fullName = name + (std::is_same_v<T, float> ? "<float>" : "<double>");
+		const auto precise = [reference](T x) -> long double {
+			return static_cast<long double>(reference(static_cast<Precise>(x)));
+		};
+
+		cases.push_back({fullName, [fullName, approximation, precise](const SweepOptions& options) {
+							 print(fullName, sweep<T>(approximation, precise, options));
+						 }});
+	}
+
+	template<FloatingPoint T>
+	inline auto add_sweeps(std::vector<SweepCase>& cases) -> void {
+		add_sweep<T>(
+			cases,
+			"Trig::cos",
+			[](T x) { return Trig::cos(x); },
+			[](auto x) { return std::cos(x); });
+		add_sweep<T>(
+			cases,
+			"Trig::sin",
+			[](T x) { return Trig::sin(x); },
+			[](auto x) { return std::sin(x); });
+		add_sweep<T>(
+			cases,
+			"Trig::tan",
+			[](T x) { return Trig::tan(x); },
+			[](auto x) { return std::tan(x); });
+		add_sweep<T>(
+			cases,
+			"Trig::sincos.sin",
+			[](T x) { return Trig::sincos(x).sin; },
+			[](auto x) { return std::sin(x); });
+		add_sweep<T>(
+			cases,
+			"Trig::sincos.cos",
+			[](T x) { return Trig::sincos(x).cos; },
+			[](auto x) { return std::cos(x); });
+		add_sweep<T>(
+			cases,
+			"Trig::atan",
+			[](T x) { return Trig::atan(x); },
+			[](auto x) { return std::atan(x); });
+		add_sweep<T>(
+			cases,
+			"Trig::tanh",
+			[](T x) { return Trig::tanh(x); },
+			[](auto x) { return std::tanh(x); });
+
+		add_sweep<T>(
+			cases,
+			"Exponentials::exp",
+			[](T x) { return Exponentials::exp(x); },
+			[](auto x) { return std::exp(x); });
+		add_sweep<T>(
+			cases,
+			"Exponentials::ln",
+			[](T x) { return Exponentials::ln(x); },
+			[](auto x) { return std::log(x); });
+		add_sweep<T>(
+			cases,
+			"Exponentials::log2",
+			[](T x) { return Exponentials::log2(x); },
+			[](auto x) { return std::log2(x); });
+		add_sweep<T>(
+			cases,
+			"Exponentials::log10",
+			[](T x) { return Exponentials::log10(x); },
+			[](auto x) { return std::log10(x); });
+		add_sweep<T>(
+			cases,
+			"Exponentials::pow2",
+			[](T x) { return Exponentials::pow2(x); },
+			[](auto x) { return std::exp2(x); });
+		add_sweep<T>(
+			cases,
+			"Exponentials::pow10",
+			[](T x) { return Exponentials::pow10(x); },
+			[](auto x) { return std::pow(static_cast<decltype(x)>(10.0), x); });
+
+		add_sweep<T>(
+			cases,
+			"General::sqrt",
+			[](T x) { return General::sqrt(x); },
+			[](auto x) { return std::sqrt(x); });
+		add_sweep<T>(
+			cases,
+			"General::rsqrt",
+			[](T x) { return General::rsqrt(x); },
+			[](auto x) { return static_cast<decltype(x)>(1.0) / std::sqrt(x); });
+	}
+
+	/// @brief Parses the unsigned integer value of the command line option at `argv[index + 1]`
+	///
+	/// @return - Whether a valid value was parsed
+	inline auto parse_value(int argc, char** argv, int& index, std::uint64_t& value) -> bool {
+		if(index + 1 >= argc) {
+			return false;
+		}
+		++index;
+		auto* end = static_cast<char*>(nullptr);
+		value = static_cast<std::uint64_t>(std::strtoull(argv[index], &end, 0)); // NOLINT
+		return end != argv[index] && *end == '\0' && value != 0ULL; // NOLINT
+	}
+} // namespace hyperion::math::accuracy
+
+auto main(int argc, char** argv) -> int {
+	using namespace hyperion::math::accuracy; // NOLINT
+
+	auto options = SweepOptions();
+	auto filters = std::vector<std::string_view>();
+	auto sweepFloat = true;
+	auto sweepDouble = true;
+	for(auto i = 1; i < argc; ++i) {
+		const auto argument = std::string_view(argv[i]); // NOLINT
+		auto value = std::uint64_t(0ULL);
+		if(argument == "--threads" && parse_value(argc, argv, i, value)) {
+			options.threads = value;
+		}
+		else if(argument == "--float-stride" && parse_value(argc, argv, i, value)) {
+			options.floatStride = value;
+		}
+		else if(argument == "--double-samples" && parse_value(argc, argv, i, value)) {
+			options.doubleSamples = value;
+		}
+		else if(argument == "--float-only") {
+			sweepDouble = false;
+		}
+		else if(argument == "--double-only") {
+			sweepFloat = false;
+		}
+		else if(!argument.starts_with("--")) {
+			filters.push_back(argument);
+		}
+		else {
+			std::fprintf(stderr,
+						 "usage: %s [--threads N] [--float-stride N] [--double-samples N] "
+						 "[--float-only | --double-only] [name filter...]\n",
+						 argv[0]); // NOLINT
+			return 1;
+		}
+	}
+
+	auto cases = std::vector<SweepCase>();
+	if(sweepFloat) {
+		add_sweeps<float>(cases);
+	}
+	if(sweepDouble) {
+		add_sweeps<double>(cases);
+	}
+
+	std::printf("sweeping with %zu threads, float stride %llu, %llu double samples\n\n",
+				options.threads,
+				static_cast<unsigned long long>(options.floatStride),
+				static_cast<unsigned long long>(options.doubleSamples));
+	for(const auto& sweepCase : cases) {
+		const auto selected = filters.empty()
+							  || std::any_of(filters.begin(), filters.end(), [&](auto filter) {
+									 return sweepCase.name.find(filter) != std::string::npos;
+								 });
+		if(selected) {
+			sweepCase.run(options);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,387 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "HyperionUtils/Concepts.h"
+
+namespace hyperion::math::accuracy {
+	using utils::concepts::FloatingPoint;
+
+	/// The number of inputs each worker claims at a time
+	static constexpr std::size_t SWEEP_CHUNK_SIZE = 4096ULL;
+	/// The number of buckets in the ULP error histogram: [0, 0.5], (0.5, 1], (1, 2], ...,
+	/// (2^(N - 3), 2^(N - 2)], then everything larger
+	static constexpr std::size_t ULP_HISTOGRAM_BUCKETS = 24ULL;
+	/// The number of rows the per-input-range error table is reported in
+	static constexpr std::size_t INPUT_RANGE_ROWS = 32ULL;
+
+	/// @brief The bits type with the same width as `T`
+	template<FloatingPoint T>
+	using Bits = std::conditional_t<std::is_same_v<T, float>, std::uint32_t, std::uint64_t>;
+
+	/// @brief Options controlling a sweep
+	struct SweepOptions {
+		/// The number of worker threads
+		std::size_t threads = std::max(std::thread::hardware_concurrency(), 1U);
+		/// The distance between consecutive `float` bit patterns swept. 1 sweeps all 2^32
+		std::uint64_t floatStride = 1ULL;
+		/// The number of `double` bit patterns sampled, spread evenly over all 2^64
+		std::uint64_t doubleSamples = 1ULL << 28U;
+	};
+
+	/// @brief The accumulated error (in ULPs of `T`) over a set of inputs
+	struct ErrorAccumulator {
+		double maxUlp = 0.0;
+		double sumUlp = 0.0;
+		std::uint64_t count = 0ULL;
+
+		inline auto add(double ulp) noexcept -> void {
+			maxUlp = std::max(maxUlp, ulp);
+			sumUlp += ulp;
+			++count;
+		}
+
+		inline auto merge(const ErrorAccumulator& other) noexcept -> void {
+			maxUlp = std::max(maxUlp, other.maxUlp);
+			sumUlp += other.sumUlp;
+			count += other.count;
+		}
+
+		[[nodiscard]] inline auto mean() const noexcept -> double {
+			return count == 0ULL ? 0.0 : sumUlp / static_cast<double>(count);
+		}
+	};
+
+	/// @brief The results of sweeping one function over its inputs
+	template<FloatingPoint T>
+	struct SweepResult {
+		/// The number of inputs swept
+		std::uint64_t inputs = 0ULL;
+		/// The error over the finite results
+		ErrorAccumulator error;
+		/// The input that produced `error.maxUlp`
+		T worstInput = static_cast<T>(0);
+		/// The number of inputs where the approximation and the reference disagreed on a
+		/// non-finite result (NaN or infinity)
+		std::uint64_t nonFiniteMismatches = 0ULL;
+		/// Counts of the ULP errors, bucketed by powers of two
+		std::array<std::uint64_t, ULP_HISTOGRAM_BUCKETS> ulpHistogram = {};
+		/// The error by the binade of |input|
+		std::vector<ErrorAccumulator> binades
+			= std::vector<ErrorAccumulator>(static_cast<std::size_t>(1ULL) << exponent_bits());
+		/// The total time spent in the approximation and the reference, across all threads
+		std::chrono::nanoseconds approximationTime = std::chrono::nanoseconds(0);
+		std::chrono::nanoseconds referenceTime = std::chrono::nanoseconds(0);
+
+		[[nodiscard]] static inline constexpr auto exponent_bits() noexcept -> std::size_t {
+			return std::is_same_v<T, float> ? 8ULL : 11ULL;
+		}
+
+		inline auto merge(const SweepResult& other) noexcept -> void {
+			if(other.error.maxUlp > error.maxUlp) {
+				worstInput = other.worstInput;
+			}
+			inputs += other.inputs;
+			error.merge(other.error);
+			nonFiniteMismatches += other.nonFiniteMismatches;
+			for(auto i = 0ULL; i < ulpHistogram.size(); ++i) {
+				ulpHistogram[i] += other.ulpHistogram[i];
+			}
+			for(auto i = 0ULL; i < binades.size(); ++i) {
+				binades[i].merge(other.binades[i]);
+			}
+			approximationTime += other.approximationTime;
+			referenceTime += other.referenceTime;
+		}
+	};
+
+	/// @brief Returns whether `value` is NaN or infinite
+	///
+	/// Checks the exponent bits rather than using `std::isfinite`, which -ffinite-math-only
+	/// (implied by -Ofast and -ffast-math in the release toolchains) lets the compiler fold to
+	/// `true`
+	///
+	/// @param value - The value to check
+	/// @return - Whether `value` isn't finite
+	template<FloatingPoint T>
+	inline auto is_non_finite(T value) noexcept -> bool {
+		constexpr auto exponentMask = std::bit_cast<Bits<T>>(std::numeric_limits<T>::infinity());
+		return (std::bit_cast<Bits<T>>(value) & exponentMask) == exponentMask;
+	}
+
+	/// @brief Returns whether `value` is NaN, by its bits like `is_non_finite`
+	///
+	/// @param value - The value to check
+	/// @return - Whether `value` is NaN
+	template<FloatingPoint T>
+	inline auto is_nan(T value) noexcept -> bool {
+		constexpr auto exponentMask = std::bit_cast<Bits<T>>(std::numeric_limits<T>::infinity());
+		constexpr auto signMask = ~(~Bits<T>(0) >> 1U);
+		return (std::bit_cast<Bits<T>>(value) & ~signMask) > exponentMask;
+	}
+
+	/// @brief Calculates the error of `approximation` relative to `reference`, in ULPs of `T` at
+	/// the magnitude of `reference`
+	///
+	/// `reference` is classified as non-finite after rounding it to `double`, so for `double`
+	/// a reference beyond the range of `double` counts as infinite
+	///
+	/// @param approximation - The approximated value
+	/// @param reference - The (higher precision) reference value
+	/// @return - The error in ULPs, or infinity if exactly one of them isn't finite or they are
+	/// different non-finite values
+	template<FloatingPoint T>
+	inline auto ulp_error(T approximation, long double reference) noexcept -> double {
+		const auto roundedReference = static_cast<double>(reference);
+		if(is_non_finite(roundedReference) || is_non_finite(approximation)) {
+			const auto widenedApproximation = static_cast<double>(approximation);
+			const auto bothNaN = is_nan(roundedReference) && is_nan(widenedApproximation);
+			const auto equal = std::bit_cast<std::uint64_t>(widenedApproximation)
+							   == std::bit_cast<std::uint64_t>(roundedReference);
+			return bothNaN || equal ? 0.0 : std::numeric_limits<double>::infinity();
+		}
+
+		// ulps are fixed-size below the normal range
+		const auto exponent
+			= std::max(std::ilogb(reference), std::numeric_limits<T>::min_exponent - 1);
+		const auto ulp = std::ldexp(1.0L, exponent - (std::numeric_limits<T>::digits - 1));
+		const auto error = std::abs(static_cast<long double>(approximation) - reference);
+		return static_cast<double>(error / ulp);
+	}
+
+	/// @brief Returns the ULP histogram bucket for the given error
+	///
+	/// @param ulp - The error, in ULPs
+	/// @return - The bucket index
+	inline auto ulp_bucket(double ulp) noexcept -> std::size_t {
+		if(ulp <= 0.5) {
+			return 0ULL;
+		}
+		const auto bucket
+			= static_cast<std::size_t>(std::max(std::ceil(std::log2(ulp)), 0.0)) + 1ULL;
+		return std::min(bucket, ULP_HISTOGRAM_BUCKETS - 1ULL);
+	}
+
+	/// @brief Generates the `index`th input of the sweep
+	///
+	/// `float`s step through all 2^32 bit patterns (every `floatStride`th one). `double`s are
+	/// sampled evenly over all 2^64 bit patterns, jittered within each step so the low mantissa
+	/// bits aren't always the same
+	///
+	/// @param index - The index of the input
+	/// @param options - The sweep options
+	/// @return - The input
+	template<FloatingPoint T>
+	inline auto sweep_input(std::uint64_t index, const SweepOptions& options) noexcept -> T {
+		if constexpr(std::is_same_v<T, float>) {
+			return std::bit_cast<float>(static_cast<std::uint32_t>(index * options.floatStride));
+		}
+		else {
+			const auto step = std::numeric_limits<std::uint64_t>::max() / options.doubleSamples;
+			// SplitMix64 finalizer, to jitter the input within its step
+			auto jitter = index + 0x9e3779b97f4a7c15ULL;
+			jitter = (jitter ^ (jitter >> 30U)) * 0xbf58476d1ce4e5b9ULL;
+			jitter = (jitter ^ (jitter >> 27U)) * 0x94d049bb133111ebULL;
+			jitter ^= jitter >> 31U;
+			return std::bit_cast<double>(index * step + jitter % step);
+		}
+	}
+
+	/// @brief Returns the number of inputs in the sweep
+	///
+	/// @param options - The sweep options
+	/// @return - The number of inputs
+	template<FloatingPoint T>
+	inline auto sweep_size(const SweepOptions& options) noexcept -> std::uint64_t {
+		if constexpr(std::is_same_v<T, float>) {
+			return ((1ULL << 32U) + options.floatStride - 1ULL) / options.floatStride;
+		}
+		else {
+			return options.doubleSamples;
+		}
+	}
+
+	/// @brief Sweeps `approximation` against `reference` over the inputs described by
+	/// `options`, across `options.threads` threads
+	///
+	/// Each worker claims chunks of `SWEEP_CHUNK_SIZE` inputs, times the approximation and the
+	/// reference over the whole chunk, then compares them
+	///
+	/// @param approximation - The function to sweep, `T(T)`
+	/// @param reference - The reference function, `long double(T)`
+	/// @param options - The sweep options
+	/// @return - The results of the sweep
+	template<FloatingPoint T, typename Approximation, typename Reference>
+	inline auto sweep(Approximation approximation, Reference reference, const SweepOptions& options)
+		-> SweepResult<T> {
+		using Clock = std::chrono::steady_clock;
+
+		const auto size = sweep_size<T>(options);
+		const auto chunks = (size + SWEEP_CHUNK_SIZE - 1ULL) / SWEEP_CHUNK_SIZE;
+		auto nextChunk = std::atomic_uint64_t(0ULL);
+		auto results = std::vector<SweepResult<T>>(options.threads);
+
+		const auto worker = [&](SweepResult<T>& result) {
+			auto inputs = std::vector<T>(SWEEP_CHUNK_SIZE);
+			auto approximations = std::vector<T>(SWEEP_CHUNK_SIZE);
+			auto references = std::vector<long double>(SWEEP_CHUNK_SIZE);
+
+			for(auto chunk = nextChunk.fetch_add(1ULL); chunk < chunks;
+				chunk = nextChunk.fetch_add(1ULL))
+			{
+				const auto first = chunk * SWEEP_CHUNK_SIZE;
+				const auto count = std::min(SWEEP_CHUNK_SIZE, size - first);
+				for(auto i = 0ULL; i < count; ++i) {
+					inputs[i] = sweep_input<T>(first + i, options);
+				}
+
+				const auto approximationStart = Clock::now();
+				for(auto i = 0ULL; i < count; ++i) {
+					approximations[i] = approximation(inputs[i]);
+				}
+				const auto referenceStart = Clock::now();
+				for(auto i = 0ULL; i < count; ++i) {
+					references[i] = reference(inputs[i]);
+				}
+				const auto referenceEnd = Clock::now();
+				result.approximationTime += referenceStart - approximationStart;
+				result.referenceTime += referenceEnd - referenceStart;
+				result.inputs += count;
+
+				for(auto i = 0ULL; i < count; ++i) {
+					const auto ulp = ulp_error(approximations[i], references[i]);
+					if(is_non_finite(ulp)) {
+						++result.nonFiniteMismatches;
+						++result.ulpHistogram.back();
+						continue;
+					}
+					// only finite results count towards the error statistics
+					if(is_non_finite(static_cast<double>(references[i]))) {
+						continue;
+					}
+
+					if(ulp > result.error.maxUlp) {
+						result.worstInput = inputs[i];
+					}
+					result.error.add(ulp);
+					++result.ulpHistogram[ulp_bucket(ulp)]; // NOLINT
+					const auto bits = std::bit_cast<Bits<T>>(std::abs(inputs[i]));
+					const auto binade = static_cast<std::size_t>(
+						bits >> static_cast<unsigned>(std::numeric_limits<T>::digits - 1));
+					result.binades[binade].add(ulp);
+				}
+			}
+		};
+
+		auto threads = std::vector<std::thread>();
+		threads.reserve(options.threads);
+		for(auto& result : results) {
+			threads.emplace_back(worker, std::ref(result));
+		}
+		for(auto& thread : threads) {
+			thread.join();
+		}
+
+		auto total = SweepResult<T>();
+		for(const auto& result : results) {
+			total.merge(result);
+		}
+		return total;
+	}
+
+	/// @brief Prints the results of a sweep
+	///
+	/// @param name - The name of the swept function
+	/// @param result - The results of the sweep
+	template<FloatingPoint T>
+	inline auto print(const std::string& name, const SweepResult<T>& result) -> void {
+		const auto total = result.inputs;
+		const auto perElement = [total](std::chrono::nanoseconds time) {
+			return total == 0ULL ? 0.0
+								 : static_cast<double>(time.count()) / static_cast<double>(total);
+		};
+		const auto approximationTime = perElement(result.approximationTime);
+		const auto referenceTime = perElement(result.referenceTime);
+
+		std::printf("==== %s ====\n", name.c_str());
+		std::printf("inputs: %llu, max error: %.4g ulp (at %.17g), mean error: %.4g ulp, "
+					"non-finite mismatches: %llu\n",
+					static_cast<unsigned long long>(total),
+					result.error.maxUlp,
+					static_cast<double>(result.worstInput),
+					result.error.mean(),
+					static_cast<unsigned long long>(result.nonFiniteMismatches));
+		std::printf("time per element (per thread): %.3f ns, reference: %.3f ns, speedup: %.2fx\n",
+					approximationTime,
+					referenceTime,
+					approximationTime == 0.0 ? 0.0 : referenceTime / approximationTime);
+
+		std::printf("error histogram:\n");
+		for(auto i = 0ULL; i < result.ulpHistogram.size(); ++i) {
+			if(result.ulpHistogram[i] == 0ULL) { // NOLINT
+				continue;
+			}
+			if(i == 0ULL) {
+				std::printf("  [0, 0.5] ulp");
+			}
+			else if(i == result.ulpHistogram.size() - 1ULL) {
+				std::printf("  > 2^%llu ulp or non-finite", i - 2ULL);
+			}
+			else if(i == 1ULL) {
+				std::printf("  (0.5, 1] ulp");
+			}
+			else {
+				std::printf("  (2^%llu, 2^%llu] ulp", i - 2ULL, i - 1ULL);
+			}
+			std::printf(": %llu (%.4f%%)\n",
+						static_cast<unsigned long long>(result.ulpHistogram[i]), // NOLINT
+						100.0 * static_cast<double>(result.ulpHistogram[i])		 // NOLINT
+							/ static_cast<double>(total));
+		}
+
+		const auto matchingNonFinite = total - result.error.count - result.nonFiniteMismatches;
+		if(matchingNonFinite != 0ULL) {
+			std::printf("  matching non-finite: %llu (%.4f%%)\n",
+						static_cast<unsigned long long>(matchingNonFinite),
+						100.0 * static_cast<double>(matchingNonFinite)
+							/ static_cast<double>(total));
+		}
+
+		std::printf("error by |input|:\n");
+		constexpr auto bias = std::numeric_limits<T>::max_exponent - 1;
+		const auto binadesPerRow = result.binades.size() / INPUT_RANGE_ROWS;
+		for(auto row = 0ULL; row < INPUT_RANGE_ROWS; ++row) {
+			auto rowError = ErrorAccumulator();
+			for(auto i = row * binadesPerRow; i < (row + 1ULL) * binadesPerRow; ++i) {
+				rowError.merge(result.binades[i]);
+			}
+			if(rowError.count == 0ULL) {
+				continue;
+			}
+
+			// binade 0 holds zero and the subnormals
+			const auto low = static_cast<long long>(row * binadesPerRow) - bias;
+			const auto high = static_cast<long long>((row + 1ULL) * binadesPerRow) - bias;
+			std::printf("  [2^%lld, 2^%lld): max %.4g ulp, mean %.4g ulp, %llu inputs\n",
+						low,
+						high,
+						rowError.maxUlp,
+						rowError.mean(),
+						static_cast<unsigned long long>(rowError.count));
+		}
+		std::printf("\n");
+		std::fflush(stdout);
+	}
+} // namespace hyperion::math::accuracy
@@ -0,0 +1,39 @@
+#include <benchmark/benchmark.h>
+
+#include "EnvelopeBenchmark.h"
+#include "ExponentialsBenchmark.h"
+#include "GeneralBenchmark.h"
+#include "InterpolatorBenchmark.h"
+#include "RandomBenchmark.h"
+#include "TrigBenchmark.h"
+#include "Vec2Benchmark.h"
+#include "Vec3Benchmark.h"
+
+auto main(int argc, char** argv) -> int {
+	using namespace hyperion::math::bench; // NOLINT
+
+	register_envelope_benchmarks<float>();
+	register_envelope_benchmarks<double>();
+	register_exponentials_benchmarks<float>();
+	register_exponentials_benchmarks<double>();
+	register_general_benchmarks<float>();
+	register_general_benchmarks<double>();
+	register_interpolator_benchmarks<float>();
+	register_interpolator_benchmarks<double>();
+	register_random_benchmarks<float>();
+	register_random_benchmarks<double>();
+	register_trig_benchmarks<float>();
+	register_trig_benchmarks<double>();
+	register_vec2_benchmarks<float>();
+	register_vec2_benchmarks<double>();
+	register_vec3_benchmarks<float>();
+	register_vec3_benchmarks<double>();
+
+	benchmark::Initialize(&argc, argv);
+	if(benchmark::ReportUnrecognizedArguments(argc, argv)) {
+		return 1;
+	}
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	return 0;
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "HyperionUtils/Concepts.h"
+
+namespace hyperion::math::bench {
+	using utils::concepts::FloatingPoint;
+
+	/// The number of inputs each benchmark iteration processes
+	static constexpr std::size_t BENCHMARK_INPUT_SIZE = 4096ULL;
+	/// The seed used to shuffle benchmark inputs, so every run sees the same sequence
+	static constexpr std::uint_fast32_t BENCHMARK_SEED = 0x5EEDU;
+
+	/// @brief Returns the name suffix identifying `T` in benchmark names
+	///
+	/// @return "<float>" or "<double>"
+	template<FloatingPoint T>
+	inline auto type_suffix() noexcept -> std::string {
+		if constexpr(std::is_same_v<T, float>) {
+			return "<float>";
+		}
+		else {
+			return "<double>";
+		}
+	}
+
+	/// @brief Generates `BENCHMARK_INPUT_SIZE` inputs evenly spread over [min, max], shuffled so
+	/// branch predictors can't learn the sequence
+	///
+	/// @param min - The minimum input
+	/// @param max - The maximum input
+	/// @return - The inputs
+	template<FloatingPoint T>
+	inline auto make_inputs(T min, T max) -> std::vector<T> {
+		auto inputs = std::vector<T>(BENCHMARK_INPUT_SIZE);
+		const auto step = (max - min) / static_cast<T>(BENCHMARK_INPUT_SIZE - 1);
+		for(auto i = 0ULL; i < inputs.size(); ++i) {
+			inputs[i] = min + step * static_cast<T>(i);
+		}
+		std::shuffle(inputs.begin(), inputs.end(), std::mt19937(BENCHMARK_SEED));
+		return inputs;
+	}
+
+	/// @brief Measures the latency of `function`: each call's input depends on the result of
+	/// the previous call, so calls can't overlap
+	///
+	/// The dependency is created by adding the previous result multiplied by an opaque zero,
+	/// so it costs every benchmarked function (and its baseline) the same multiply-add
+	///
+	/// @param state - The benchmark state
+	/// @param function - The function to benchmark, `T(T)`
+	/// @param min - The minimum input
+	/// @param max - The maximum input
+	template<FloatingPoint T, typename Function>
+	inline auto latency(benchmark::State& state, Function function, T min, T max) -> void {
+		const auto inputs = make_inputs(min, max);
+		auto zero = static_cast<T>(0);
+		benchmark::DoNotOptimize(zero);
+
+		auto result = static_cast<T>(0);
+		for(auto _ : state) {
+			for(const auto input : inputs) {
+				result = function(input + result * zero);
+			}
+		}
+		benchmark::DoNotOptimize(result);
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(inputs.size()));
+	}
+
+	/// @brief Measures the throughput of `function`: calls are independent, so the CPU (and
+	/// the compiler) can overlap and vectorize them
+	///
+	/// @param state - The benchmark state
+	/// @param function - The function to benchmark, `T(T)`
+	/// @param min - The minimum input
+	/// @param max - The maximum input
+	template<FloatingPoint T, typename Function>
+	inline auto throughput(benchmark::State& state, Function function, T min, T max) -> void {
+		const auto inputs = make_inputs(min, max);
+		auto outputs = std::vector<T>(inputs.size());
+
+		for(auto _ : state) {
+			for(auto i = 0ULL; i < inputs.size(); ++i) {
+				outputs[i] = function(inputs[i]);
+			}
+			benchmark::DoNotOptimize(outputs.data());
+			benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(inputs.size()));
+	}
+
+	/// @brief Measures the throughput of the batch (`std::span`) form of a function
+	///
+	/// @param state - The benchmark state
+	/// @param function - The function to benchmark, `void(std::span<const T>, std::span<T>)`
+	/// @param min - The minimum input
+	/// @param max - The maximum input
+	template<FloatingPoint T, typename Function>
+	inline auto batch(benchmark::State& state, Function function, T min, T max) -> void {
+		const auto inputs = make_inputs(min, max);
+		auto outputs = std::vector<T>(inputs.size());
+
+		for(auto _ : state) {
+			function(std::span<const T>(inputs), std::span<T>(outputs));
+			benchmark::DoNotOptimize(outputs.data());
+			benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(inputs.size()));
+	}
+
+	/// @brief Registers latency and throughput benchmarks for `function` and for its standard
+	/// library `baseline`, over inputs in [min, max]
+	///
+	/// @param name - The name of the function
+	/// @param function - The function, `T(T)`
+	/// @param baselineName - The name of the baseline function
+	/// @param baseline - The baseline function, `T(T)`
+	/// @param min - The minimum input
+	/// @param max - The maximum input
+	template<FloatingPoint T, typename Function, typename Baseline>
+	inline auto register_unary(const std::string& name,
+							   Function function,
+							   const std::string& baselineName,
+							   Baseline baseline,
+							   T min,
+							   T max) -> void {
+		const auto suffix = type_suffix<T>();
+		benchmark::RegisterBenchmark((name + suffix + "/latency").c_str(),
+									 latency<T, Function>,
+									 function,
+									 min,
+									 max);
+		benchmark::RegisterBenchmark((baselineName + suffix + "/latency").c_str(),
+									 latency<T, Baseline>,
+									 baseline,
+									 min,
+									 max);
+		benchmark::RegisterBenchmark((name + suffix + "/throughput").c_str(),
+									 throughput<T, Function>,
+									 function,
+									 min,
+									 max);
+		benchmark::RegisterBenchmark((baselineName + suffix + "/throughput").c_str(),
+									 throughput<T, Baseline>,
+									 baseline,
+									 min,
+									 max);
+	}
+
+	/// @brief Registers a throughput benchmark for the batch (`std::span`) form of a function.
+	/// Its baseline is the throughput benchmark registered by `register_unary`
+	///
+	/// @param name - The name of the function
+	/// @param function - The function, `void(std::span<const T>, std::span<T>)`
+	/// @param min - The minimum input
+	/// @param max - The maximum input
+	template<FloatingPoint T, typename Function>
+	inline auto register_batch(const std::string& name, Function function, T min, T max) -> void {
+		benchmark::RegisterBenchmark((name + type_suffix<T>() + "/batch").c_str(),
+									 batch<T, Function>,
+									 function,
+									 min,
+									 max);
+	}
+} // namespace hyperion::math::bench
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "BenchmarkHelpers.h"
+#include "HyperionMath/Envelope.h"
+
+namespace hyperion::math::bench {
+
+	/// The number of voices the envelope benchmark runs at once
+	static constexpr std::size_t ENVELOPE_VOICES = 512ULL;
+	/// The sample rate the envelopes run at
+	static constexpr std::size_t ENVELOPE_SAMPLE_RATE = 48000ULL;
+	/// The block size the envelopes are rendered in
+	static constexpr std::size_t ENVELOPE_BLOCK_SIZE = 256ULL;
+	/// The number of blocks each note is held for, about half a second
+	static constexpr std::size_t ENVELOPE_NOTE_BLOCKS = 94ULL;
+	/// The number of blocks between the starts of consecutive notes on a voice
+	static constexpr std::size_t ENVELOPE_NOTE_PERIOD = 160ULL;
+
+	/// @brief Measures applying `ENVELOPE_VOICES` envelopes, each to its own voice's block of
+	/// `ENVELOPE_BLOCK_SIZE` samples. Every voice plays a repeating note, staggered so the
+	/// voices are spread across every stage
+	///
+	/// @param state - The benchmark state
+	template<FloatingPoint T>
+	inline auto envelope_voices(benchmark::State& state) -> void {
+		auto parameters = EnvelopeParameters<T>();
+		parameters.decayType = InterpolationType::Exponential;
+		auto envelopes = std::vector<Envelope<T>>(ENVELOPE_VOICES,
+												  Envelope<T>(parameters, ENVELOPE_SAMPLE_RATE));
+		auto blocks = std::vector<std::size_t>(ENVELOPE_VOICES);
+		for(auto voice = 0ULL; voice < ENVELOPE_VOICES; ++voice) {
+			blocks[voice] = voice % ENVELOPE_NOTE_PERIOD;
+		}
+		auto buffer = std::vector<T>(ENVELOPE_VOICES * ENVELOPE_BLOCK_SIZE, static_cast<T>(0.5));
+
+		for(auto _ : state) {
+			for(auto voice = 0ULL; voice < ENVELOPE_VOICES; ++voice) {
+				auto& envelope = envelopes[voice];
+				auto& block = blocks[voice];
+				if(block == 0ULL) {
+					envelope.note_on();
+				}
+				else if(block == ENVELOPE_NOTE_BLOCKS) {
+					envelope.note_off();
+				}
+				block = (block + 1ULL) % ENVELOPE_NOTE_PERIOD;
+
+				envelope.apply(std::span<T>(buffer).subspan(voice * ENVELOPE_BLOCK_SIZE,
+															ENVELOPE_BLOCK_SIZE));
+			}
+			benchmark::DoNotOptimize(buffer.data());
+			benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed(state.iterations()
+								* static_cast<std::int64_t>(ENVELOPE_VOICES * ENVELOPE_BLOCK_SIZE));
+	}
+
+	template<FloatingPoint T>
+	inline auto register_envelope_benchmarks() -> void {
+		const auto suffix = type_suffix<T>();
+		benchmark::RegisterBenchmark(("Envelope::apply" + suffix + "/512_voices").c_str(),
+									 envelope_voices<T>);
+	}
+} // namespace hyperion::math::bench
@@ -0,0 +1,111 @@
+#pragma once
+
+#ifndef __MSC_VER
+	#include <cmath>
+#endif
+
+#include "BenchmarkHelpers.h"
+#include "HyperionMath/Exponentials.h"
+
+namespace hyperion::math::bench {
+
+	template<FloatingPoint T>
+	inline auto register_exponentials_benchmarks() -> void {
+		constexpr auto logMin = static_cast<T>(0.001);
+		constexpr auto logMax = static_cast<T>(1000.0);
+
+		// frexp returns two values, so fold them into one to fit the harness
+		register_unary<T>(
+			"Exponentials::frexp",
+			[](T x) {
+				auto exponent = 0;
+				return Exponentials::frexp(x, &exponent) + static_cast<T>(exponent);
+			},
+			"std::frexp",
+			[](T x) {
+				auto exponent = 0;
+				return std::frexp(x, &exponent) + static_cast<T>(exponent);
+			},
+			logMin,
+			logMax);
+
+		register_unary<T>(
+			"Exponentials::exp",
+			[](T x) { return Exponentials::exp(x); },
+			"std::exp",
+			[](T x) { return std::exp(x); },
+			static_cast<T>(-20.0),
+			static_cast<T>(20.0));
+
+		register_unary<T>(
+			"Exponentials::ln",
+			[](T x) { return Exponentials::ln(x); },
+			"std::log",
+			[](T x) { return std::log(x); },
+			logMin,
+			logMax);
+		register_batch<T>(
+			"Exponentials::ln",
+			[](std::span<const T> x, std::span<T> out) { Exponentials::ln(x, out); },
+			logMin,
+			logMax);
+
+		register_unary<T>(
+			"Exponentials::log2",
+			[](T x) { return Exponentials::log2(x); },
+			"std::log2",
+			[](T x) { return std::log2(x); },
+			logMin,
+			logMax);
+		register_batch<T>(
+			"Exponentials::log2",
+			[](std::span<const T> x, std::span<T> out) { Exponentials::log2(x, out); },
+			logMin,
+			logMax);
+
+		register_unary<T>(
+			"Exponentials::log10",
+			[](T x) { return Exponentials::log10(x); },
+			"std::log10",
+			[](T x) { return std::log10(x); },
+			logMin,
+			logMax);
+		register_batch<T>(
+			"Exponentials::log10",
+			[](std::span<const T> x, std::span<T> out) { Exponentials::log10(x, out); },
+			logMin,
+			logMax);
+
+		register_unary<T>(
+			"Exponentials::pow2",
+			[](T x) { return Exponentials::pow2(x); },
+			"std::exp2",
+			[](T x) { return std::exp2(x); },
+			static_cast<T>(-20.0),
+			static_cast<T>(20.0));
+
+		register_unary<T>(
+			"Exponentials::pow10",
+			[](T x) { return Exponentials::pow10(x); },
+			"std::pow(10,x)",
+			[](T x) { return std::pow(static_cast<T>(10.0), x); },
+			static_cast<T>(-10.0),
+			static_cast<T>(10.0));
+
+		register_unary<T>(
+			"Exponentials::pow",
+			[](T x) { return Exponentials::pow(x, static_cast<T>(1.7)); },
+			"std::pow",
+			[](T x) { return std::pow(x, static_cast<T>(1.7)); },
+			logMin,
+			static_cast<T>(100.0));
+
+		register_unary<T>(
+			"Exponentials::pow<7>",
+			[](T x) { return Exponentials::pow<7>(x); },
+			"std::pow(x,7)",
+			[](T x) { return static_cast<T>(std::pow(x, 7)); },
+			static_cast<T>(-4.0),
+			static_cast<T>(4.0));
+	}
+} // namespace hyperion::math::bench
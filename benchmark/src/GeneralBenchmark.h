@@ -0,0 +1,102 @@
+#pragma once
+
+#ifndef __MSC_VER
+	#include <cmath>
+#endif
+
+#include <algorithm>
+
+#include "BenchmarkHelpers.h"
+#include "HyperionMath/General.h"
+
+namespace hyperion::math::bench {
+
+	template<FloatingPoint T>
+	inline auto register_general_benchmarks() -> void {
+		constexpr auto min = static_cast<T>(-1000.0);
+		constexpr auto max = static_cast<T>(1000.0);
+		constexpr auto sqrtMin = static_cast<T>(0.001);
+
+		register_unary<T>(
+			"General::max",
+			[](T x) { return General::max(x, static_cast<T>(0.5)); },
+			"std::max",
+			[](T x) { return std::max(x, static_cast<T>(0.5)); },
+			min,
+			max);
+
+		register_unary<T>(
+			"General::min",
+			[](T x) { return General::min(x, static_cast<T>(0.5)); },
+			"std::min",
+			[](T x) { return std::min(x, static_cast<T>(0.5)); },
+			min,
+			max);
+
+		register_unary<T>(
+			"General::abs",
+			[](T x) { return General::abs(x); },
+			"std::abs",
+			[](T x) { return std::abs(x); },
+			min,
+			max);
+
+		register_unary<T>(
+			"General::sqrt",
+			[](T x) { return General::sqrt(x); },
+			"std::sqrt",
+			[](T x) { return std::sqrt(x); },
+			sqrtMin,
+			max);
+		register_batch<T>(
+			"General::sqrt",
+			[](std::span<const T> x, std::span<T> out) { General::sqrt(x, out); },
+			sqrtMin,
+			max);
+
+		register_unary<T>(
+			"General::rsqrt",
+			[](T x) { return General::rsqrt(x); },
+			"1/std::sqrt",
+			[](T x) { return static_cast<T>(1.0) / std::sqrt(x); },
+			sqrtMin,
+			max);
+		register_batch<T>(
+			"General::rsqrt",
+			[](std::span<const T> x, std::span<T> out) { General::rsqrt(x, out); },
+			sqrtMin,
+			max);
+
+		register_unary<T>(
+			"General::trunc",
+			[](T x) { return General::trunc(x); },
+			"std::trunc",
+			[](T x) { return std::trunc(x); },
+			min,
+			max);
+
+		register_unary<T>(
+			"General::fmod",
+			[](T x) { return General::fmod(x, static_cast<T>(3.7)); },
+			"std::fmod",
+			[](T x) { return std::fmod(x, static_cast<T>(3.7)); },
+			min,
+			max);
+
+		register_unary<T>(
+			"General::round",
+			[](T x) { return static_cast<T>(General::round(x)); },
+			"std::lround",
+			[](T x) { return static_cast<T>(std::lround(x)); },
+			static_cast<T>(0.0),
+			max);
+
+		register_unary<T>(
+			"General::roundU",
+			[](T x) { return static_cast<T>(General::roundU(x)); },
+			"std::llround",
+			[](T x) { return static_cast<T>(std::llround(x)); },
+			static_cast<T>(0.0),
+			max);
+	}
+} // namespace hyperion::math::bench
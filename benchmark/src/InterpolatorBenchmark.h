@@ -0,0 +1,400 @@
+#pragma once
+
+#ifndef __MSC_VER
+	#include <cmath>
+#endif
+
+#include <array>
+#include <span>
+
+#include "BenchmarkHelpers.h"
+#include "HyperionMath/Interpolator.h"
+#include "HyperionMath/InterpolatorBank.h"
+#include "HyperionMath/RampTable.h"
+
+namespace hyperion::math::bench {
+
+	/// The sample rate the interpolators run at
+	static constexpr std::size_t INTERPOLATOR_SAMPLE_RATE = 44100ULL;
+	/// The block size block-processing benchmarks run at. Must divide `BENCHMARK_INPUT_SIZE`
+	static constexpr std::size_t INTERPOLATOR_BLOCK_SIZE = 256ULL;
+	/// The number of parameters the bank benchmarks smooth at once
+	static constexpr std::size_t INTERPOLATOR_BANK_SIZE = 1024ULL;
+	/// The length of the declicking fades the fade benchmarks render
+	static constexpr std::size_t INTERPOLATOR_FADE_SIZE = 64ULL;
+
+	/// @brief Returns the transition length that makes an interpolation last exactly
+	/// `BENCHMARK_INPUT_SIZE` samples
+	///
+	/// @return - The transition length, in seconds
+	template<FloatingPoint T>
+	inline constexpr auto interpolator_transition_length() noexcept -> T {
+		return static_cast<T>(BENCHMARK_INPUT_SIZE) / static_cast<T>(INTERPOLATOR_SAMPLE_RATE);
+	}
+
+	/// @brief Measures generating one full transition of an `Interpolator`, sample by sample
+	///
+	/// @param state - The benchmark state
+	template<FloatingPoint T, InterpolationType Type>
+	inline auto interpolator(benchmark::State& state) -> void {
+		auto outputs = std::vector<T>(BENCHMARK_INPUT_SIZE);
+
+		for(auto _ : state) {
+			auto interpolator = Interpolator<T, Type>(static_cast<T>(1.0),
+													  static_cast<T>(0.0),
+													  interpolator_transition_length<T>(),
+													  INTERPOLATOR_SAMPLE_RATE);
+			for(auto& output : outputs) {
+				output = interpolator.get_next_value();
+			}
+			benchmark::DoNotOptimize(outputs.data());
+			benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(outputs.size()));
+	}
+
+	/// @brief Measures generating the same transition as `interpolator<T, Type>`, with
+	/// `Interpolator::process` in blocks of `INTERPOLATOR_BLOCK_SIZE` samples
+	///
+	/// @param state - The benchmark state
+	/// @param incremental - Whether the interpolator runs in incremental mode
+	template<FloatingPoint T, InterpolationType Type>
+	inline auto interpolator_process(benchmark::State& state, bool incremental) -> void {
+		auto outputs = std::vector<T>(BENCHMARK_INPUT_SIZE);
+
+		for(auto _ : state) {
+			auto interpolator = Interpolator<T, Type>(static_cast<T>(1.0),
+													  static_cast<T>(0.0),
+													  interpolator_transition_length<T>(),
+													  INTERPOLATOR_SAMPLE_RATE);
+			interpolator.set_incremental(incremental);
+			for(auto i = 0ULL; i < outputs.size(); i += INTERPOLATOR_BLOCK_SIZE) {
+				interpolator.process(std::span<T>(outputs).subspan(i, INTERPOLATOR_BLOCK_SIZE));
+			}
+			benchmark::DoNotOptimize(outputs.data());
+			benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(outputs.size()));
+	}
+
+	/// @brief Measures refilling a stereo buffer, either interleaved or planar, and applying one
+	/// transition to it with `Interpolator::apply_interleaved` or `Interpolator::apply_planar`,
+	/// or frame by frame with `get_next_value`
+	///
+	/// @param state - The benchmark state
+	/// @param interleaved - Whether the buffer is interleaved
+	/// @param perFrame - Whether to apply the transition frame by frame
+	template<FloatingPoint T, InterpolationType Type>
+	inline auto
+	interpolator_stereo(benchmark::State& state, bool interleaved, bool perFrame) -> void {
+		auto left = std::vector<T>(BENCHMARK_INPUT_SIZE, static_cast<T>(0.5));
+		auto right = std::vector<T>(BENCHMARK_INPUT_SIZE, static_cast<T>(0.5));
+		auto buffer = std::vector<T>(2ULL * BENCHMARK_INPUT_SIZE, static_cast<T>(0.5));
+		const auto channels = std::array<std::span<T>, 2>{left, right};
+
+		for(auto _ : state) {
+			// refill the buffers, so repeated gain ramps don't decay them into subnormals
+			if(interleaved) {
+				std::fill(buffer.begin(), buffer.end(), static_cast<T>(0.5));
+			}
+			else {
+				std::fill(left.begin(), left.end(), static_cast<T>(0.5));
+				std::fill(right.begin(), right.end(), static_cast<T>(0.5));
+			}
+			auto interpolator = Interpolator<T, Type>(static_cast<T>(1.0),
+													  static_cast<T>(0.0),
+													  interpolator_transition_length<T>(),
+													  INTERPOLATOR_SAMPLE_RATE);
+			for(auto i = 0ULL; i < BENCHMARK_INPUT_SIZE; i += INTERPOLATOR_BLOCK_SIZE) {
+				if(perFrame) {
+					for(auto frame = i; frame < i + INTERPOLATOR_BLOCK_SIZE; ++frame) {
+						const auto value = interpolator.get_next_value();
+						if(interleaved) {
+							buffer[2ULL * frame] *= value;
+							buffer[2ULL * frame + 1ULL] *= value;
+						}
+						else {
+							left[frame] *= value;
+							right[frame] *= value;
+						}
+					}
+				}
+				else if(interleaved) {
+					interpolator.template apply_interleaved<2ULL>(
+						std::span<T>(buffer).subspan(2ULL * i, 2ULL * INTERPOLATOR_BLOCK_SIZE));
+				}
+				else {
+					const auto blocks = std::array<std::span<T>, 2>{
+						channels[0].subspan(i, INTERPOLATOR_BLOCK_SIZE),
+						channels[1].subspan(i, INTERPOLATOR_BLOCK_SIZE)};
+					interpolator.apply_planar(blocks);
+				}
+			}
+			benchmark::DoNotOptimize(buffer.data());
+			benchmark::DoNotOptimize(left.data());
+			benchmark::DoNotOptimize(right.data());
+			benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed(state.iterations()
+								* static_cast<std::int64_t>(2ULL * BENCHMARK_INPUT_SIZE));
+	}
+
+	/// @brief Measures starting and rendering a `INTERPOLATOR_FADE_SIZE` sample fade out with an
+	/// `Interpolator`
+	///
+	/// @param state - The benchmark state
+	template<FloatingPoint T, InterpolationType Type>
+	inline auto interpolator_fade(benchmark::State& state) -> void {
+		auto block = std::array<T, INTERPOLATOR_FADE_SIZE>();
+
+		for(auto _ : state) {
+			// a one second transition at this rate lasts exactly the length of the fade. Hide
+			// it from the optimizer, so the fade isn't evaluated at compile time
+			auto sampleRate = INTERPOLATOR_FADE_SIZE - 1ULL;
+			benchmark::DoNotOptimize(sampleRate);
+			auto interpolator = Interpolator<T, Type>(static_cast<T>(0.0),
+													  static_cast<T>(1.0),
+													  static_cast<T>(1.0),
+													  sampleRate);
+			interpolator.process(block);
+			benchmark::DoNotOptimize(block.data());
+			benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed(state.iterations()
+								* static_cast<std::int64_t>(INTERPOLATOR_FADE_SIZE));
+	}
+
+	/// @brief Measures restarting and rendering the same fade as `interpolator_fade<T, Type>`
+	/// with a `TableInterpolator` over a table generated at compile time
+	///
+	/// @param state - The benchmark state
+	template<FloatingPoint T, InterpolationType Type>
+	inline auto table_interpolator_fade(benchmark::State& state) -> void {
+		static constexpr auto table = make_ramp_table<T, Type, INTERPOLATOR_FADE_SIZE>(
+			static_cast<T>(0.0),
+			static_cast<T>(1.0));
+		auto block = std::array<T, INTERPOLATOR_FADE_SIZE>();
+		auto interpolator = TableInterpolator(table);
+
+		for(auto _ : state) {
+			interpolator.reset();
+			interpolator.process(block);
+			benchmark::DoNotOptimize(block.data());
+			benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed(state.iterations()
+								* static_cast<std::int64_t>(INTERPOLATOR_FADE_SIZE));
+	}
+
+	/// @brief Measures advancing `INTERPOLATOR_BANK_SIZE` independent `Interpolator`s, sample
+	/// by sample, over `INTERPOLATOR_BLOCK_SIZE` samples
+	///
+	/// @param state - The benchmark state
+	template<FloatingPoint T, InterpolationType Type>
+	inline auto interpolator_array(benchmark::State& state) -> void {
+		auto interpolators = std::vector<Interpolator<T, Type>>(
+			INTERPOLATOR_BANK_SIZE,
+			Interpolator<T, Type>(static_cast<T>(1.0),
+								  static_cast<T>(0.0),
+								  interpolator_transition_length<T>(),
+								  INTERPOLATOR_SAMPLE_RATE));
+
+		for(auto _ : state) {
+			for(auto sample = 0ULL; sample < INTERPOLATOR_BLOCK_SIZE; ++sample) {
+				for(auto& interpolator : interpolators) {
+					benchmark::DoNotOptimize(interpolator.get_next_value());
+				}
+			}
+			state.PauseTiming();
+			for(auto& interpolator : interpolators) {
+				interpolator.reset(Some(static_cast<T>(0.0)), None());
+			}
+			state.ResumeTiming();
+		}
+		state.SetItemsProcessed(state.iterations()
+								* static_cast<std::int64_t>(INTERPOLATOR_BANK_SIZE
+															* INTERPOLATOR_BLOCK_SIZE));
+	}
+
+	/// @brief Measures advancing an `InterpolatorBank` of `INTERPOLATOR_BANK_SIZE` lanes, sample
+	/// by sample, over `INTERPOLATOR_BLOCK_SIZE` samples
+	///
+	/// @param state - The benchmark state
+	template<FloatingPoint T, InterpolationType Type>
+	inline auto interpolator_bank(benchmark::State& state) -> void {
+		auto bank = InterpolatorBank<T, Type>(INTERPOLATOR_BANK_SIZE, INTERPOLATOR_SAMPLE_RATE);
+
+		for(auto _ : state) {
+			state.PauseTiming();
+			for(auto lane = 0ULL; lane < bank.size(); ++lane) {
+				bank.set_value(lane, static_cast<T>(0.0));
+				bank.set_target(lane, static_cast<T>(1.0), interpolator_transition_length<T>());
+			}
+			state.ResumeTiming();
+			for(auto sample = 0ULL; sample < INTERPOLATOR_BLOCK_SIZE; ++sample) {
+				bank.advance();
+				benchmark::DoNotOptimize(bank.values().data());
+			}
+		}
+		state.SetItemsProcessed(state.iterations()
+								* static_cast<std::int64_t>(INTERPOLATOR_BANK_SIZE
+															* INTERPOLATOR_BLOCK_SIZE));
+	}
+
+	/// @brief Measures generating the same transition as `interpolator<T, Type>`, written out
+	/// by hand with `<cmath>`
+	///
+	/// @param state - The benchmark state
+	template<FloatingPoint T, InterpolationType Type>
+	inline auto interpolator_baseline(benchmark::State& state) -> void {
+		constexpr auto initial = static_cast<T>(0.0);
+		constexpr auto target = static_cast<T>(1.0);
+		// the time factors `Interpolator` uses for its logarithmic and exponential shapes
+		constexpr auto logTimeFactor = static_cast<T>(5.0);
+		constexpr auto expTimeFactor = static_cast<T>(0.693);
+		constexpr auto samples = static_cast<T>(BENCHMARK_INPUT_SIZE);
+		constexpr auto pi = static_cast<T>(3.14159265358979323846);
+		auto outputs = std::vector<T>(BENCHMARK_INPUT_SIZE);
+
+		for(auto _ : state) {
+			for(auto i = 0ULL; i < outputs.size(); ++i) {
+				const auto sample = static_cast<T>(i);
+				if constexpr(Type == InterpolationType::Linear) {
+					outputs[i] = initial + (target - initial) * sample / samples;
+				}
+				else if constexpr(Type == InterpolationType::Logarithmic) {
+					outputs[i] = (initial - target) * std::exp(-sample * logTimeFactor / samples)
+								 + target;
+				}
+				else if constexpr(Type == InterpolationType::Exponential) {
+					outputs[i] = (target - initial)
+									 * (std::exp(sample * expTimeFactor / samples)
+										- static_cast<T>(1.0))
+								 + initial;
+				}
+				else if constexpr(Type == InterpolationType::Cosine) {
+					outputs[i] = initial
+								 + (target - initial)
+									   * (static_cast<T>(1.0) - std::cos(pi * sample / samples))
+									   / static_cast<T>(2.0);
+				}
+				else if constexpr(Type == InterpolationType::EqualPower) {
+					outputs[i] = initial
+								 + (target - initial)
+									   * std::sin(pi * sample / (static_cast<T>(2.0) * samples));
+				}
+				else {
+					// smoothstep, which is also cubic Hermite with the default, flat, tangents
+					const auto t = sample / samples;
+					outputs[i] = initial
+								 + (target - initial) * t * t
+									   * (static_cast<T>(3.0) - static_cast<T>(2.0) * t);
+				}
+			}
+			benchmark::DoNotOptimize(outputs.data());
+			benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(outputs.size()));
+	}
+
+	template<FloatingPoint T>
+	inline auto register_interpolator_benchmarks() -> void {
+		const auto suffix = type_suffix<T>();
+		benchmark::RegisterBenchmark(("Interpolator<Linear>" + suffix).c_str(),
+									 interpolator<T, InterpolationType::Linear>);
+		benchmark::RegisterBenchmark(("Interpolator<Linear>::process" + suffix).c_str(),
+									 interpolator_process<T, InterpolationType::Linear>,
+									 false);
+		benchmark::RegisterBenchmark(("std::linear_ramp" + suffix).c_str(),
+									 interpolator_baseline<T, InterpolationType::Linear>);
+		benchmark::RegisterBenchmark(("Interpolator<Logarithmic>" + suffix).c_str(),
+									 interpolator<T, InterpolationType::Logarithmic>);
+		benchmark::RegisterBenchmark(("Interpolator<Logarithmic>::process" + suffix).c_str(),
+									 interpolator_process<T, InterpolationType::Logarithmic>,
+									 false);
+		benchmark::RegisterBenchmark(
+			("Interpolator<Logarithmic>::process" + suffix + "/incremental").c_str(),
+			interpolator_process<T, InterpolationType::Logarithmic>,
+			true);
+		benchmark::RegisterBenchmark(("std::exp_logarithmic_ramp" + suffix).c_str(),
+									 interpolator_baseline<T, InterpolationType::Logarithmic>);
+		benchmark::RegisterBenchmark(("Interpolator<Exponential>" + suffix).c_str(),
+									 interpolator<T, InterpolationType::Exponential>);
+		benchmark::RegisterBenchmark(("Interpolator<Exponential>::process" + suffix).c_str(),
+									 interpolator_process<T, InterpolationType::Exponential>,
+									 false);
+		benchmark::RegisterBenchmark(
+			("Interpolator<Exponential>::process" + suffix + "/incremental").c_str(),
+			interpolator_process<T, InterpolationType::Exponential>,
+			true);
+		benchmark::RegisterBenchmark(("std::exp_exponential_ramp" + suffix).c_str(),
+									 interpolator_baseline<T, InterpolationType::Exponential>);
+		benchmark::RegisterBenchmark(("Interpolator<Cosine>" + suffix).c_str(),
+									 interpolator<T, InterpolationType::Cosine>);
+		benchmark::RegisterBenchmark(("Interpolator<Cosine>::process" + suffix).c_str(),
+									 interpolator_process<T, InterpolationType::Cosine>,
+									 false);
+		benchmark::RegisterBenchmark(("std::cos_ramp" + suffix).c_str(),
+									 interpolator_baseline<T, InterpolationType::Cosine>);
+		benchmark::RegisterBenchmark(("Interpolator<EqualPower>" + suffix).c_str(),
+									 interpolator<T, InterpolationType::EqualPower>);
+		benchmark::RegisterBenchmark(("Interpolator<EqualPower>::process" + suffix).c_str(),
+									 interpolator_process<T, InterpolationType::EqualPower>,
+									 false);
+		benchmark::RegisterBenchmark(("std::sin_equal_power_ramp" + suffix).c_str(),
+									 interpolator_baseline<T, InterpolationType::EqualPower>);
+		benchmark::RegisterBenchmark(("Interpolator<Smoothstep>" + suffix).c_str(),
+									 interpolator<T, InterpolationType::Smoothstep>);
+		benchmark::RegisterBenchmark(("Interpolator<Smoothstep>::process" + suffix).c_str(),
+									 interpolator_process<T, InterpolationType::Smoothstep>,
+									 false);
+		benchmark::RegisterBenchmark(("std::smoothstep_ramp" + suffix).c_str(),
+									 interpolator_baseline<T, InterpolationType::Smoothstep>);
+		benchmark::RegisterBenchmark(("Interpolator<CubicHermite>" + suffix).c_str(),
+									 interpolator<T, InterpolationType::CubicHermite>);
+		benchmark::RegisterBenchmark(("Interpolator<CubicHermite>::process" + suffix).c_str(),
+									 interpolator_process<T, InterpolationType::CubicHermite>,
+									 false);
+		benchmark::RegisterBenchmark(("std::cubic_hermite_ramp" + suffix).c_str(),
+									 interpolator_baseline<T, InterpolationType::CubicHermite>);
+
+		benchmark::RegisterBenchmark(
+			("Interpolator<Linear>::apply_interleaved" + suffix + "/stereo").c_str(),
+			interpolator_stereo<T, InterpolationType::Linear>,
+			true,
+			false);
+		benchmark::RegisterBenchmark(
+			("Interpolator<Linear>::get_next_value" + suffix + "/stereo_interleaved").c_str(),
+			interpolator_stereo<T, InterpolationType::Linear>,
+			true,
+			true);
+		benchmark::RegisterBenchmark(
+			("Interpolator<Linear>::apply_planar" + suffix + "/stereo").c_str(),
+			interpolator_stereo<T, InterpolationType::Linear>,
+			false,
+			false);
+		benchmark::RegisterBenchmark(
+			("Interpolator<Linear>::get_next_value" + suffix + "/stereo_planar").c_str(),
+			interpolator_stereo<T, InterpolationType::Linear>,
+			false,
+			true);
+
+		benchmark::RegisterBenchmark(("Interpolator<Cosine>/fade" + suffix).c_str(),
+									 interpolator_fade<T, InterpolationType::Cosine>);
+		benchmark::RegisterBenchmark(("TableInterpolator<Cosine>/fade" + suffix).c_str(),
+									 table_interpolator_fade<T, InterpolationType::Cosine>);
+		benchmark::RegisterBenchmark(("Interpolator<Logarithmic>/fade" + suffix).c_str(),
+									 interpolator_fade<T, InterpolationType::Logarithmic>);
+		benchmark::RegisterBenchmark(("TableInterpolator<Logarithmic>/fade" + suffix).c_str(),
+									 table_interpolator_fade<T, InterpolationType::Logarithmic>);
+
+		benchmark::RegisterBenchmark(("InterpolatorBank<Linear>" + suffix).c_str(),
+									 interpolator_bank<T, InterpolationType::Linear>);
+		benchmark::RegisterBenchmark(("Interpolator<Linear>[]" + suffix).c_str(),
+									 interpolator_array<T, InterpolationType::Linear>);
+		benchmark::RegisterBenchmark(("InterpolatorBank<Logarithmic>" + suffix).c_str(),
+									 interpolator_bank<T, InterpolationType::Logarithmic>);
+		benchmark::RegisterBenchmark(("Interpolator<Logarithmic>[]" + suffix).c_str(),
+									 interpolator_array<T, InterpolationType::Logarithmic>);
+	}
+} // namespace hyperion::math::bench
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <random>
+#include <span>
+#include <string>
+
+#include "BenchmarkHelpers.h"
+#include "HyperionMath/Random.h"
+
+namespace hyperion::math::bench {
+
+	/// @brief Measures generating `BENCHMARK_INPUT_SIZE` values with `generator`
+	///
+	/// @param state - The benchmark state
+	/// @param generator - The generator to benchmark, `T()`
+	template<FloatingPoint T, typename Generator>
+	inline auto random(benchmark::State& state, Generator generator) -> void {
+		auto outputs = std::vector<T>(BENCHMARK_INPUT_SIZE);
+
+		for(auto _ : state) {
+			for(auto& output : outputs) {
+				output = generator();
+			}
+			benchmark::DoNotOptimize(outputs.data());
+			benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(outputs.size()));
+	}
+
+	/// @brief Registers benchmarks for `UniformDistribution<EngineType>`, and for `EngineType`
+	/// driving `std::uniform_real_distribution`
+	///
+	/// @param name - The name of the engine
+	template<FloatingPoint T, typename EngineType>
+	inline auto register_engine_benchmark(const std::string& name) -> void {
+		const auto suffix = type_suffix<T>();
+
+		benchmark::RegisterBenchmark(("UniformDistribution<" + name + ">" + suffix).c_str(),
+									 [](benchmark::State& state) {
+										 auto distribution = UniformDistribution<EngineType, T>(
+											 EngineType(BENCHMARK_SEED));
+										 random<T>(state, [&distribution]() {
+											 return distribution();
+										 });
+									 });
+		benchmark::RegisterBenchmark(
+			("std::uniform_real_distribution<" + name + ">" + suffix).c_str(),
+			[](benchmark::State& state) {
+				auto engine = EngineType(BENCHMARK_SEED);
+				auto distribution = std::uniform_real_distribution<T>();
+				random<T>(state, [&]() { return distribution(engine); });
+			});
+	}
+
+	template<FloatingPoint T>
+	inline auto register_random_benchmarks() -> void {
+		const auto suffix = type_suffix<T>();
+
+		// each thread draws from its own engine, so throughput should scale with the threads
+		benchmark::RegisterBenchmark(("random_value" + suffix).c_str(),
+									 [](benchmark::State& state) {
+										 random<T>(state, []() { return random_value<T>(); });
+									 })
+			->ThreadRange(1, 4);
+		benchmark::RegisterBenchmark(("random_value(min,max)" + suffix).c_str(),
+									 [](benchmark::State& state) {
+										 random<T>(state, []() {
+											 return random_value<T>(static_cast<T>(-1.0),
+																	static_cast<T>(1.0));
+										 });
+									 });
+		benchmark::RegisterBenchmark(
+			("UniformDistribution<LinearCongruentialEngine>" + suffix).c_str(),
+			[](benchmark::State& state) {
+				auto distribution = UniformDistribution<LinearCongruentialEngine<>, T>();
+				random<T>(state, [&distribution]() { return distribution(); });
+			});
+		// the same distribution through the type-erased interface, for the cost of virtual dispatch
+		benchmark::RegisterBenchmark(
+			("DistributionAdaptor<UniformDistribution<LinearCongruentialEngine>>" + suffix).c_str(),
+			[](benchmark::State& state) {
+				auto adaptor
+					= DistributionAdaptor<UniformDistribution<LinearCongruentialEngine<>, T>>();
+				Distribution<LinearCongruentialEngine<>, T>* distribution = &adaptor;
+				// hide the dynamic type, so the calls can't be devirtualized
+				benchmark::DoNotOptimize(distribution);
+				random<T>(state, [distribution]() { return (*distribution)(); });
+			});
+
+		register_engine_benchmark<T, Xoshiro256PlusPlusEngine>("Xoshiro256PlusPlusEngine");
+		register_engine_benchmark<T, Xoshiro128PlusEngine>("Xoshiro128PlusEngine");
+		register_engine_benchmark<T, Pcg32Engine>("Pcg32Engine");
+		register_engine_benchmark<T, Pcg64Engine>("Pcg64Engine");
+		register_engine_benchmark<T, SplitMix64Engine>("SplitMix64Engine");
+		register_engine_benchmark<T, Philox4x32Engine>("Philox4x32Engine");
+		benchmark::RegisterBenchmark(("Philox4x32Engine::fill_uniform" + suffix).c_str(),
+									 [](benchmark::State& state) {
+										 auto engine = Philox4x32Engine(BENCHMARK_SEED);
+										 auto outputs = std::vector<T>(BENCHMARK_INPUT_SIZE);
+										 for(auto _ : state) {
+											 engine.fill_uniform(std::span<T>(outputs));
+											 benchmark::DoNotOptimize(outputs.data());
+											 benchmark::ClobberMemory();
+										 }
+										 state.SetItemsProcessed(
+											 state.iterations()
+											 * static_cast<std::int64_t>(outputs.size()));
+									 });
+
+		// `LinearCongruentialEngine` is an LCG, so `std::minstd_rand` is its closest baseline,
+		// with `std::mt19937` as the common default
+		benchmark::RegisterBenchmark(
+			("std::uniform_real_distribution<std::minstd_rand>" + suffix).c_str(),
+			[](benchmark::State& state) {
+				auto engine = std::minstd_rand(BENCHMARK_SEED);
+				auto distribution = std::uniform_real_distribution<T>();
+				random<T>(state, [&]() { return distribution(engine); });
+			});
+		benchmark::RegisterBenchmark(
+			("std::uniform_real_distribution<std::mt19937>" + suffix).c_str(),
+			[](benchmark::State& state) {
+				auto engine = std::mt19937(BENCHMARK_SEED);
+				auto distribution = std::uniform_real_distribution<T>();
+				random<T>(state, [&]() { return distribution(engine); });
+			});
+	}
+} // namespace hyperion::math::bench
@@ -0,0 +1,86 @@
+#pragma once
+
+#ifndef __MSC_VER
+	#include <cmath>
+#endif
+
+#include "BenchmarkHelpers.h"
+#include "HyperionMath/Constants.h"
+#include "HyperionMath/Trig.h"
+
+namespace hyperion::math::bench {
+
+	template<FloatingPoint T>
+	inline auto register_trig_benchmarks() -> void {
+		constexpr auto min = -Constants<T>::twoPi;
+		constexpr auto max = Constants<T>::twoPi;
+
+		register_unary<T>(
+			"Trig::cos",
+			[](T x) { return Trig::cos(x); },
+			"std::cos",
+			[](T x) { return std::cos(x); },
+			min,
+			max);
+		register_batch<T>(
+			"Trig::cos",
+			[](std::span<const T> x, std::span<T> out) { Trig::cos(x, out); },
+			min,
+			max);
+
+		register_unary<T>(
+			"Trig::sin",
+			[](T x) { return Trig::sin(x); },
+			"std::sin",
+			[](T x) { return std::sin(x); },
+			min,
+			max);
+		register_batch<T>(
+			"Trig::sin",
+			[](std::span<const T> x, std::span<T> out) { Trig::sin(x, out); },
+			min,
+			max);
+
+		// stay inside (-pi / 2, pi / 2), clear of the asymptotes
+		register_unary<T>(
+			"Trig::tan",
+			[](T x) { return Trig::tan(x); },
+			"std::tan",
+			[](T x) { return std::tan(x); },
+			static_cast<T>(-1.5),
+			static_cast<T>(1.5));
+		register_batch<T>(
+			"Trig::tan",
+			[](std::span<const T> x, std::span<T> out) { Trig::tan(x, out); },
+			static_cast<T>(-1.5),
+			static_cast<T>(1.5));
+
+		// sincos returns two values, so fold them into one to fit the harness
+		register_unary<T>(
+			"Trig::sincos",
+			[](T x) {
+				const auto result = Trig::sincos(x);
+				return result.sin + result.cos;
+			},
+			"std::sin+std::cos",
+			[](T x) { return std::sin(x) + std::cos(x); },
+			min,
+			max);
+
+		register_unary<T>(
+			"Trig::atan",
+			[](T x) { return Trig::atan(x); },
+			"std::atan",
+			[](T x) { return std::atan(x); },
+			static_cast<T>(-10.0),
+			static_cast<T>(10.0));
+
+		register_unary<T>(
+			"Trig::tanh",
+			[](T x) { return Trig::tanh(x); },
+			"std::tanh",
+			[](T x) { return std::tanh(x); },
+			static_cast<T>(-5.0),
+			static_cast<T>(5.0));
+	}
+} // namespace hyperion::math::bench
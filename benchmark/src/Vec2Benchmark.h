@@ -0,0 +1,74 @@
+#pragma once
+
+#ifndef __MSC_VER
+	#include <cmath>
+#endif
+
+#include "BenchmarkHelpers.h"
+#include "HyperionMath/Vec2.h"
+
+namespace hyperion::math::bench {
+
+	/// The vector operations are benchmarked on `Vec2(x, x + 1)` against the same math written
+	/// out by hand with `<cmath>` (named `baseline::...`). Results that are vectors are folded
+	/// into a scalar to fit the harness
+	template<FloatingPoint T>
+	inline auto register_vec2_benchmarks() -> void {
+		constexpr auto min = static_cast<T>(0.001);
+		constexpr auto max = static_cast<T>(1000.0);
+		constexpr auto one = static_cast<T>(1.0);
+		constexpr auto two = static_cast<T>(2.0);
+
+		register_unary<T>(
+			"Vec2::magnitude",
+			[](T x) { return Vec2<T>(x, x + one).template magnitude<T>(); },
+			"baseline::Vec2::magnitude",
+			[](T x) { return std::sqrt(x * x + (x + one) * (x + one)); },
+			min,
+			max);
+
+		register_unary<T>(
+			"Vec2::dot_prod",
+			[](T x) { return Vec2<T>(x, x + one).template dot_prod<T>(Vec2<T>(two, x)); },
+			"baseline::Vec2::dot_prod",
+			[](T x) { return x * two + (x + one) * x; },
+			min,
+			max);
+
+		register_unary<T>(
+			"Vec2::cross_prod",
+			[](T x) { return Vec2<T>(x, x + one).template cross_prod<T>(Vec2<T>(two, x)); },
+			"baseline::Vec2::cross_prod",
+			[](T x) { return x * x - (x + one) * two; },
+			min,
+			max);
+
+		register_unary<T>(
+			"Vec2::normalized",
+			[](T x) {
+				const auto normalized = Vec2<T>(x, x + one).template normalized<T>();
+				return normalized.x() + normalized.y();
+			},
+			"baseline::Vec2::normalized",
+			[](T x) {
+				const auto magnitude = std::sqrt(x * x + (x + one) * (x + one));
+				return x / magnitude + (x + one) / magnitude;
+			},
+			min,
+			max);
+
+		register_unary<T>(
+			"Vec2::normalized_fast",
+			[](T x) {
+				const auto normalized = Vec2<T>(x, x + one).template normalized_fast<T>();
+				return normalized.x() + normalized.y();
+			},
+			"baseline::Vec2::normalized_fast",
+			[](T x) {
+				const auto scale = one / std::sqrt(x * x + (x + one) * (x + one));
+				return x * scale + (x + one) * scale;
+			},
+			min,
+			max);
+	}
+} // namespace hyperion::math::bench
@@ -0,0 +1,100 @@
+#pragma once
+
+#ifndef __MSC_VER
+	#include <cmath>
+#endif
+
+#include "BenchmarkHelpers.h"
+#include "HyperionMath/Vec3.h"
+
+namespace hyperion::math::bench {
+
+	/// The vector operations are benchmarked on `Vec3(x, x + 1, x + 2)` against the same math
+	/// written out by hand with `<cmath>` (named `baseline::...`). Results that are vectors are
+	/// folded into a scalar to fit the harness
+	template<FloatingPoint T>
+	inline auto register_vec3_benchmarks() -> void {
+		constexpr auto min = static_cast<T>(0.001);
+		constexpr auto max = static_cast<T>(1000.0);
+		constexpr auto one = static_cast<T>(1.0);
+		constexpr auto two = static_cast<T>(2.0);
+
+		register_unary<T>(
+			"Vec3::magnitude",
+			[](T x) { return Vec3<T>(x, x + one, x + two).template magnitude<T>(); },
+			"baseline::Vec3::magnitude",
+			[](T x) { return std::sqrt(x * x + (x + one) * (x + one) + (x + two) * (x + two)); },
+			min,
+			max);
+
+		register_unary<T>(
+			"Vec3::dot_prod",
+			[](T x) {
+				return Vec3<T>(x, x + one, x + two).template dot_prod<T>(Vec3<T>(two, one, x));
+			},
+			"baseline::Vec3::dot_prod",
+			[](T x) { return x * two + (x + one) * one + (x + two) * x; },
+			min,
+			max);
+
+		register_unary<T>(
+			"Vec3::cross_prod",
+			[](T x) {
+				const auto cross = Vec3<T>(x, x + one, x + two).cross_prod(Vec3<T>(two, one, x));
+				return cross.x() + cross.y() + cross.z();
+			},
+			"baseline::Vec3::cross_prod",
+			[](T x) {
+				const auto y = x + one;
+				const auto z = x + two;
+				return (y * x - z * one) + (z * two - x * x) + (x * one - y * two);
+			},
+			min,
+			max);
+
+		register_unary<T>(
+			"Vec3::normalized",
+			[](T x) {
+				const auto normalized = Vec3<T>(x, x + one, x + two).template normalized<T>();
+				return normalized.x() + normalized.y() + normalized.z();
+			},
+			"baseline::Vec3::normalized",
+			[](T x) {
+				const auto magnitude
+					= std::sqrt(x * x + (x + one) * (x + one) + (x + two) * (x + two));
+				return x / magnitude + (x + one) / magnitude + (x + two) / magnitude;
+			},
+			min,
+			max);
+
+		register_unary<T>(
+			"Vec3::normalized_fast",
+			[](T x) {
+				const auto normalized = Vec3<T>(x, x + one, x + two).template normalized_fast<T>();
+				return normalized.x() + normalized.y() + normalized.z();
+			},
+			"baseline::Vec3::normalized_fast",
+			[](T x) {
+				const auto scale
+					= one / std::sqrt(x * x + (x + one) * (x + one) + (x + two) * (x + two));
+				return x * scale + (x + one) * scale + (x + two) * scale;
+			},
+			min,
+			max);
+
+		register_unary<T>(
+			"Vec3::reflected",
+			[](T x) {
+				const auto normal = Vec3<T>(static_cast<T>(0.0), one, static_cast<T>(0.0));
+				const auto reflected = Vec3<T>(x, -x, x + one).reflected(normal);
+				return reflected.x() + reflected.y() + reflected.z();
+			},
+			"baseline::Vec3::reflected",
+			[](T x) {
+				// with n = (0, 1, 0), v . n = -x
+				return x + (-x - two * -x) + (x + one);
+			},
+			min,
+			max);
+	}
+} // namespace hyperion::math::bench
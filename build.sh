@@ -4,3 +4,5 @@ cd build
 ninja
 cd ../test/build
 ninja
+cd ../../benchmark/build
+ninja
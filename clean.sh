@@ -4,3 +4,5 @@ cd build
 ninja clean
 cd ../test/build
 ninja clean
+cd ../../benchmark/build
+ninja clean
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include <variant>
+
+#include "HyperionUtils/Concepts.h"
+#include "HyperionUtils/Macros.h"
+#include "Interpolator.h"
+
+namespace hyperion::math {
+	using utils::concepts::FloatingPoint;
+
+	IGNORE_PADDING_START
+	/// @brief A breakpoint in an automation curve: at `offset` samples into the block, start
+	/// interpolating to `target` over `transitionLengthSeconds`, with the shape `type`
+	///
+	/// @tparam T - The floating point type of the automated value
+	template<FloatingPoint T>
+	struct AutomationEvent {
+		/// The sample the event occurs at, relative to the start of the block
+		size_t offset = 0ULL;
+		/// The value to interpolate to
+		T target = Interpolator<T>::DEFAULT_TARGET_VALUE;
+		/// The shape of the interpolation
+		InterpolationType type = InterpolationType::Linear;
+		/// The transition time to interpolate over
+		T transitionLengthSeconds = Interpolator<T>::DEFAULT_TRANSITION_LENGTH;
+	};
+
+	/// @brief Renders sample-accurate breakpoint automation into blocks.
+	///
+	/// Each block is split at the offsets of its events, and each segment is rendered with a
+	/// single block call to an `Interpolator` of the event's shape, starting from the value the
+	/// automation had reached when the event occurred. Segments carry over between blocks, so a
+	/// transition may span many of them.
+	///
+	/// @tparam T - The floating point type to perform operations in
+	template<FloatingPoint T>
+	class BreakpointAutomation {
+	  public:
+		using Event = AutomationEvent<T>;
+
+		static constexpr T DEFAULT_INITIAL_VALUE = Interpolator<T>::DEFAULT_INITIAL_VALUE;
+		static constexpr size_t DEFAULT_SAMPLE_RATE = Interpolator<T>::DEFAULT_SAMPLE_RATE;
+
+		/// @brief Creates a `BreakpointAutomation` holding `initialValue`
+		///
+		/// @param initialValue - The value to hold until the first event
+		/// @param sampleRate - The sample rate to process at
+		constexpr explicit BreakpointAutomation(T initialValue = DEFAULT_INITIAL_VALUE,
+												size_t sampleRate = DEFAULT_SAMPLE_RATE) noexcept
+			: m_sample_rate(sampleRate),
+			  m_interpolator(Interpolator<T>(initialValue,
+											 initialValue,
+											 Interpolator<T>::DEFAULT_TRANSITION_LENGTH,
+											 sampleRate)) {
+		}
+		constexpr BreakpointAutomation(const BreakpointAutomation& automation) noexcept = default;
+		constexpr BreakpointAutomation(BreakpointAutomation&& automation) noexcept = default;
+		~BreakpointAutomation() noexcept = default;
+
+		/// @brief Fills `out` with the next `out.size()` values of the automation, starting a new
+		/// segment at each event in `events`
+		/// @note `events` must be sorted by offset. Events with an offset past the end of the
+		/// block take effect at the end of the block
+		///
+		/// @param out - The buffer to fill with automation values
+		/// @param events - The events occurring during this block
+		///
+		/// @return - Whether every value in `out` is the same: there were no events and the
+		/// automation had already settled
+		inline auto process(std::span<T> out, std::span<const Event> events) noexcept -> bool {
+			return render(out, events, [](auto& interpolator, std::span<T> segment) {
+				return interpolator.process(segment);
+			});
+		}
+
+		/// @brief Multiplies `buffer`, in place, by the next `buffer.size()` values of the
+		/// automation, starting a new segment at each event in `events`
+		/// @note `events` must be sorted by offset. Events with an offset past the end of the
+		/// block take effect at the end of the block
+		///
+		/// @param buffer - The buffer to apply the automation values to
+		/// @param events - The events occurring during this block
+		///
+		/// @return - Whether all of `buffer` was multiplied by the same value: there were no
+		/// events and the automation had already settled
+		inline auto apply(std::span<T> buffer, std::span<const Event> events) noexcept -> bool {
+			return render(buffer, events, [](auto& interpolator, std::span<T> segment) {
+				return interpolator.apply(segment);
+			});
+		}
+
+		/// @brief Returns whether the current segment has finished, so the automation holds a
+		/// constant value until the next event
+		///
+		/// @return - Whether this has settled
+		[[nodiscard]] constexpr inline auto is_settled() const noexcept -> bool {
+			return std::visit([](const auto& interpolator) { return interpolator.is_settled(); },
+							  m_interpolator);
+		}
+
+		/// @brief Returns the most recently generated value
+		///
+		/// @return - The current automation value
+		[[nodiscard]] constexpr inline auto get_current_value() const noexcept -> T {
+			return std::visit(
+				[](const auto& interpolator) { return interpolator.get_current_value(); },
+				m_interpolator);
+		}
+
+		/// @brief Sets the sample rate to use for interpolation. The segment in progress
+		/// continues from the same point in time at the new rate
+		///
+		/// @param sampleRate - The sample rate to use for interpolation
+		inline auto set_sample_rate(size_t sampleRate) noexcept -> void {
+			m_sample_rate = sampleRate;
+			std::visit(
+				[sampleRate](auto& interpolator) { interpolator.set_sample_rate(sampleRate); },
+				m_interpolator);
+		}
+
+		constexpr auto operator=(const BreakpointAutomation& automation) noexcept
+			-> BreakpointAutomation& = default;
+		constexpr auto operator=(BreakpointAutomation&& automation) noexcept
+			-> BreakpointAutomation& = default;
+
+	  private:
+		size_t m_sample_rate;
+		AnyInterpolator<T> m_interpolator;
+
+		/// @brief Renders `buffer`, split at the offsets of `events`
+		///
+		/// @param buffer - The buffer to render into
+		/// @param events - The events occurring during this block
+		/// @param renderSegment - Renders a segment, returning whether it was constant,
+		/// `bool(Interpolator&, std::span<T>)`
+		///
+		/// @return - Whether all of `buffer` was rendered from a single constant value
+		template<typename RenderSegment>
+		inline auto render(std::span<T> buffer,
+						   std::span<const Event> events,
+						   RenderSegment renderSegment) noexcept -> bool {
+			auto position = size_t(0);
+			for(const auto& event : events) {
+				const auto offset = std::clamp(event.offset, position, buffer.size());
+				render_segment(buffer.subspan(position, offset - position), renderSegment);
+				start_segment(event);
+				position = offset;
+			}
+			const auto constant = render_segment(buffer.subspan(position), renderSegment);
+			return events.empty() && constant;
+		}
+
+		template<typename RenderSegment>
+		inline auto
+		render_segment(std::span<T> segment, RenderSegment renderSegment) noexcept -> bool {
+			if(segment.empty()) {
+				return true;
+			}
+			return std::visit(
+				[segment, renderSegment](auto& interpolator) {
+					return renderSegment(interpolator, segment);
+				},
+				m_interpolator);
+		}
+
+		/// @brief Starts interpolating from the current value as prescribed by `event`
+		///
+		/// @param event - The event to start
+		inline auto start_segment(const Event& event) noexcept -> void {
+			m_interpolator = make_interpolator(event.type,
+											   event.target,
+											   get_current_value(),
+											   event.transitionLengthSeconds,
+											   m_sample_rate);
+		}
+	};
+	IGNORE_PADDING_STOP
+} // namespace hyperion::math
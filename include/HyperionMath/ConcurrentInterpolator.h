@@ -0,0 +1,205 @@
+#pragma once
+
+#include <atomic>
+#include <span>
+
+#include "General.h"
+#include "HyperionUtils/Concepts.h"
+#include "HyperionUtils/Macros.h"
+#include "HyperionUtils/OptionAndResult.h"
+#include "Interpolator.h"
+
+namespace hyperion::math {
+	using utils::None;
+	using utils::Option;
+	using utils::concepts::FloatingPoint;
+
+	IGNORE_PADDING_START
+	/// @brief An `Interpolator` whose target can be set from another thread.
+	///
+	/// `set_target` may be called from any thread (for example a UI or automation thread) while
+	/// the audio thread runs the interpolator. The target is passed through a single lock-free
+	/// atomic: setting it is one atomic store, and the audio thread checks it with one atomic
+	/// load at the start of each block (`process`, `apply`, or an explicit
+	/// `apply_pending_target`). Neither side ever blocks or allocates. If the target is set
+	/// several times within one block, only the latest value is applied.
+	///
+	/// Every other member function must only be called from the audio thread.
+	///
+	/// @tparam T - The floating point type to perform operations in
+	/// @tparam Type - The type of interpolation
+	template<FloatingPoint T, InterpolationType Type = InterpolationType::Linear>
+	class ConcurrentInterpolator {
+	  public:
+		static_assert(std::atomic<T>::is_always_lock_free,
+					  "ConcurrentInterpolator requires lock-free atomic floating point values");
+
+		/// @brief Creates a default `ConcurrentInterpolator`
+		ConcurrentInterpolator() noexcept = default;
+
+		/// @brief Creates a `ConcurrentInterpolator` with the given target and initial values,
+		/// time to interpolate over, and sample rate
+		///
+		/// @param targetValue - The target final value to interpolate to
+		/// @param initialValue - The initial value to start interpolation from
+		/// @param transitionLengthSeconds - The transition time to interpolate over
+		/// @param sampleRate - The sample rate to process at
+		ConcurrentInterpolator(T targetValue,
+							   T initialValue,
+							   T transitionLengthSeconds,
+							   size_t sampleRate) noexcept
+			: m_interpolator(targetValue, initialValue, transitionLengthSeconds, sampleRate),
+			  m_applied_target(targetValue), m_pending_target(targetValue) {
+		}
+		ConcurrentInterpolator(const ConcurrentInterpolator& interpolator) = delete;
+		ConcurrentInterpolator(ConcurrentInterpolator&& interpolator) = delete;
+		~ConcurrentInterpolator() noexcept = default;
+
+		/// @brief Sets the target value to interpolate to. Safe to call from any thread; the
+		/// new target takes effect at the start of the audio thread's next block
+		///
+		/// @param targetValue - The value to interpolate to
+		inline auto set_target(T targetValue) noexcept -> void {
+			m_pending_target.store(targetValue, std::memory_order_release);
+		}
+
+		/// @brief Applies the most recently set target, if it has changed since the last one
+		/// applied. Called automatically by `process` and `apply`; callers using
+		/// `get_next_value` should call it once per block
+		///
+		/// @return - Whether a new target was applied
+		inline auto apply_pending_target() noexcept -> bool {
+			const auto target = m_pending_target.load(std::memory_order_acquire);
+			if(General::bit_equal(target, m_applied_target)) {
+				return false;
+			}
+
+			m_applied_target = target;
+			m_interpolator.set_target(target);
+			return true;
+		}
+
+		/// @brief Gets the next value in the interpolation sequence. Doesn't check for a new
+		/// target; see `apply_pending_target`
+		///
+		/// @param currentSample - The (optional) sample in the sequence to get the value for
+		///
+		/// @return - The interpolation value
+		inline auto get_next_value(Option<size_t> currentSample = None()) noexcept -> T {
+			return m_interpolator.get_next_value(currentSample);
+		}
+
+		/// @brief Applies any pending target, then fills `out` with the next `out.size()` values
+		/// in the interpolation sequence
+		///
+		/// @param out - The buffer to fill with interpolation values
+		///
+		/// @return - Whether every value in `out` is the same. See `Interpolator::process`
+		inline auto process(std::span<T> out) noexcept -> bool {
+			apply_pending_target();
+			return m_interpolator.process(out);
+		}
+
+		/// @brief Applies any pending target, then multiplies `buffer`, in place, by the next
+		/// `buffer.size()` values in the interpolation sequence
+		///
+		/// @param buffer - The buffer to apply the interpolation values to
+		///
+		/// @return - Whether all of `buffer` was multiplied by the same value. See
+		/// `Interpolator::apply`
+		inline auto apply(std::span<T> buffer) noexcept -> bool {
+			apply_pending_target();
+			return m_interpolator.apply(buffer);
+		}
+
+		/// @brief Applies any pending target, then multiplies every channel of a planar buffer,
+		/// in place, by the next values in the interpolation sequence. See
+		/// `Interpolator::apply_planar`
+		///
+		/// @param channels - The channels to apply the interpolation values to
+		///
+		/// @return - Whether every channel was multiplied by the same value
+		inline auto apply_planar(std::span<const std::span<T>> channels) noexcept -> bool {
+			apply_pending_target();
+			return m_interpolator.apply_planar(channels);
+		}
+
+		/// @brief Applies any pending target, then multiplies every channel of an interleaved
+		/// buffer, in place, by the next values in the interpolation sequence. See
+		/// `Interpolator::apply_interleaved`
+		///
+		/// @param buffer - The buffer to apply the interpolation values to
+		/// @param numChannels - The number of interleaved channels
+		///
+		/// @return - Whether all of `buffer` was multiplied by the same value
+		inline auto apply_interleaved(std::span<T> buffer, size_t numChannels) noexcept -> bool {
+			apply_pending_target();
+			return m_interpolator.apply_interleaved(buffer, numChannels);
+		}
+
+		/// @brief Returns whether the transition to the most recently applied target has
+		/// finished. A target set since then is not taken into account until it is applied
+		///
+		/// @return - Whether this has settled
+		[[nodiscard]] inline auto is_settled() const noexcept -> bool {
+			return m_interpolator.is_settled();
+		}
+
+		/// @brief Returns the number of values left in the transition to the most recently
+		/// applied target
+		///
+		/// @return - The number of remaining transition values, `0` if this has settled
+		[[nodiscard]] inline auto samples_remaining() const noexcept -> size_t {
+			return m_interpolator.samples_remaining();
+		}
+
+		/// @brief Resets the interpolator. See `Interpolator::reset`
+		///
+		/// @param initialValue - The initial value to start interpolation from
+		/// @param transitionLengthSeconds - The transition time to interpolate over
+		inline auto
+		reset(Option<T> initialValue, Option<T> transitionLengthSeconds) noexcept -> void {
+			m_interpolator.reset(initialValue, transitionLengthSeconds);
+		}
+
+		/// @brief Sets the sample rate to use for interpolation. See
+		/// `Interpolator::set_sample_rate`
+		///
+		/// @param sampleRate - The sample rate to use for interpolation
+		inline auto set_sample_rate(size_t sampleRate) noexcept -> void {
+			m_interpolator.set_sample_rate(sampleRate);
+		}
+
+		/// @brief Sets the factor of the sample rate to render at. See
+		/// `Interpolator::set_oversampling_factor`
+		///
+		/// @param factor - The oversampling factor, at least `1`
+		inline auto set_oversampling_factor(size_t factor) noexcept -> void {
+			m_interpolator.set_oversampling_factor(factor);
+		}
+
+		/// @brief Sets whether logarithmic and exponential interpolation advance incrementally.
+		/// See `Interpolator::set_incremental`
+		///
+		/// @param incremental - Whether to interpolate incrementally
+		inline auto set_incremental(bool incremental) noexcept -> void {
+			m_interpolator.set_incremental(incremental);
+		}
+
+		auto
+		operator=(const ConcurrentInterpolator& interpolator) -> ConcurrentInterpolator& = delete;
+		auto operator=(ConcurrentInterpolator&& interpolator) -> ConcurrentInterpolator& = delete;
+
+	  private:
+		static constexpr size_t CACHE_LINE_SIZE = 64ULL;
+
+		Interpolator<T, Type> m_interpolator = Interpolator<T, Type>();
+		/// Only accessed by the audio thread
+		T m_applied_target = Interpolator<T, Type>::DEFAULT_TARGET_VALUE;
+		/// Written by any thread, read by the audio thread. Kept on its own cache line so writes
+		/// to it don't contend with the audio thread's state
+		alignas(CACHE_LINE_SIZE) std::atomic<T> m_pending_target
+			= Interpolator<T, Type>::DEFAULT_TARGET_VALUE;
+	};
+	IGNORE_PADDING_STOP
+} // namespace hyperion::math
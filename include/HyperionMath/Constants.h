@@ -11,6 +11,7 @@ namespace hyperion::math {
 		static const constexpr FloatType pi = static_cast<FloatType>(3.1415926535897932384626433);
 		static const constexpr FloatType twoPi = static_cast<FloatType>(2.0) * pi;
 		static const constexpr FloatType twoOverPi = static_cast<FloatType>(2.0) / pi;
+		static const constexpr FloatType oneOverPi = static_cast<FloatType>(1.0) / pi;
 		static const constexpr FloatType piOver2 = pi / static_cast<FloatType>(2.0);
 		static const constexpr FloatType threePiOver2 = static_cast<FloatType>(3.0) * piOver2;
 		static const constexpr FloatType fourOverPi = static_cast<FloatType>(4.0) / pi;
@@ -0,0 +1,386 @@
+#pragma once
+
+#include <algorithm>
+#include <gsl/gsl>
+#include <limits>
+#include <span>
+#include <variant>
+
+#include "General.h"
+#include "HyperionUtils/Concepts.h"
+#include "HyperionUtils/Macros.h"
+#include "Interpolator.h"
+
+namespace hyperion::math {
+	using utils::concepts::FloatingPoint;
+
+	/// @brief The stages of an `Envelope`, in the order they occur
+	enum class EnvelopeStage
+	{
+		/// The envelope is silent, waiting for a note
+		Idle = 0,
+		/// Holding the value the envelope had when the note started, before the attack
+		Delay,
+		/// Rising to the peak, `1`
+		Attack,
+		/// Holding the peak
+		Hold,
+		/// Falling to the sustain level
+		Decay,
+		/// Holding the sustain level until the note ends
+		Sustain,
+		/// Falling to `0` after the note ends
+		Release
+	};
+
+	IGNORE_PADDING_START
+	/// @brief The timing, levels and curve shapes of an `Envelope`
+	///
+	/// @tparam T - The floating point type of the envelope
+	template<FloatingPoint T>
+	struct EnvelopeParameters {
+		/// The time between the start of a note and the start of the attack
+		T delaySeconds = gsl::narrow_cast<T>(0.0);
+		/// The time to rise to the peak
+		T attackSeconds = gsl::narrow_cast<T>(0.01);
+		/// The time to hold the peak
+		T holdSeconds = gsl::narrow_cast<T>(0.0);
+		/// The time to fall to the sustain level
+		T decaySeconds = gsl::narrow_cast<T>(0.1);
+		/// The level to hold while the note is held, in [0, 1]
+		T sustainLevel = gsl::narrow_cast<T>(0.7);
+		/// The time to fall to `0` after the note ends
+		T releaseSeconds = gsl::narrow_cast<T>(0.2);
+		/// The shape of the attack
+		InterpolationType attackType = InterpolationType::Linear;
+		/// The shape of the decay
+		InterpolationType decayType = InterpolationType::Logarithmic;
+		/// The shape of the release
+		InterpolationType releaseType = InterpolationType::Logarithmic;
+	};
+
+	/// @brief A delay/attack/hold/decay/sustain/release envelope generator.
+	///
+	/// `note_on` starts the delay (or, if it is empty, the attack) and `note_off` starts the
+	/// release. Each ramp is rendered by an `Interpolator` of the stage's curve shape, starting
+	/// from the value the envelope had reached when the stage began, so retriggering or
+	/// releasing part-way through a stage never jumps. Blocks are split only at stage
+	/// boundaries, so each stage's portion of a block is generated with a single block call
+	/// and there is no per-sample branching.
+	///
+	/// In legato mode, `note_on` only restarts the envelope if it is idle or releasing, so
+	/// overlapping notes continue the same envelope.
+	///
+	/// @tparam T - The floating point type to perform operations in
+	template<FloatingPoint T>
+	class Envelope {
+	  public:
+		using Parameters = EnvelopeParameters<T>;
+
+		static constexpr size_t DEFAULT_SAMPLE_RATE = Interpolator<T>::DEFAULT_SAMPLE_RATE;
+		/// The value the envelope rises to during the attack
+		static constexpr T PEAK_VALUE = gsl::narrow_cast<T>(1.0);
+
+		/// @brief Creates an idle `Envelope`
+		///
+		/// @param parameters - The timing, levels and shapes of the envelope
+		/// @param sampleRate - The sample rate to process at
+		constexpr explicit Envelope(const Parameters& parameters = Parameters(),
+									size_t sampleRate = DEFAULT_SAMPLE_RATE) noexcept
+			: m_parameters(parameters), m_sample_rate(sampleRate) {
+		}
+		constexpr Envelope(const Envelope& envelope) noexcept = default;
+		constexpr Envelope(Envelope&& envelope) noexcept = default;
+		~Envelope() noexcept = default;
+
+		/// @brief Starts a note. Unless this is in legato mode and a note is already held, the
+		/// envelope restarts from the delay stage at its current value
+		inline auto note_on() noexcept -> void {
+			if(m_legato && m_stage != EnvelopeStage::Idle && m_stage != EnvelopeStage::Release) {
+				return;
+			}
+			start_hold(EnvelopeStage::Delay, m_parameters.delaySeconds);
+		}
+
+		/// @brief Ends the note, starting the release from the current value
+		inline auto note_off() noexcept -> void {
+			if(m_stage == EnvelopeStage::Idle || m_stage == EnvelopeStage::Release) {
+				return;
+			}
+			start_ramp(EnvelopeStage::Release,
+					   gsl::narrow_cast<T>(0.0),
+					   m_parameters.releaseSeconds,
+					   m_parameters.releaseType);
+		}
+
+		/// @brief Immediately silences the envelope
+		constexpr inline auto reset() noexcept -> void {
+			m_stage = EnvelopeStage::Idle;
+			m_value = gsl::narrow_cast<T>(0.0);
+			m_hold_samples_remaining = std::numeric_limits<size_t>::max();
+		}
+
+		/// @brief Fills `out` with the next `out.size()` values of the envelope
+		///
+		/// @param out - The buffer to fill with envelope values
+		///
+		/// @return - Whether every value in `out` is the same, for example because the envelope
+		/// is idle or sustaining
+		inline auto process(std::span<T> out) noexcept -> bool {
+			return render(
+				out,
+				[](auto& interpolator, std::span<T> segment) { interpolator.process(segment); },
+				[](std::span<T> segment, T value) {
+					std::fill(segment.begin(), segment.end(), value);
+				});
+		}
+
+		/// @brief Multiplies `buffer`, in place, by the next `buffer.size()` values of the
+		/// envelope. Segments where the envelope holds exactly `1` are left untouched
+		///
+		/// @param buffer - The buffer to apply the envelope values to
+		///
+		/// @return - Whether all of `buffer` was multiplied by the same value, for example
+		/// because the envelope is idle or sustaining
+		inline auto apply(std::span<T> buffer) noexcept -> bool {
+			return render(
+				buffer,
+				[](auto& interpolator, std::span<T> segment) { interpolator.apply(segment); },
+				[](std::span<T> segment, T value) { General::scale(segment, value); });
+		}
+
+		/// @brief Returns the stage the envelope is in
+		///
+		/// @return - The current stage
+		[[nodiscard]] constexpr inline auto get_stage() const noexcept -> EnvelopeStage {
+			return m_stage;
+		}
+
+		/// @brief Returns whether the envelope is producing sound, ie whether it isn't idle
+		///
+		/// @return - Whether this is active
+		[[nodiscard]] constexpr inline auto is_active() const noexcept -> bool {
+			return m_stage != EnvelopeStage::Idle;
+		}
+
+		/// @brief Returns the most recently generated value
+		///
+		/// @return - The current envelope value
+		[[nodiscard]] constexpr inline auto get_current_value() const noexcept -> T {
+			return m_value;
+		}
+
+		/// @brief Sets the timing, levels and shapes of the envelope. The stage in progress is
+		/// unaffected; the new parameters are used from the next stage on
+		///
+		/// @param parameters - The new parameters
+		constexpr inline auto set_parameters(const Parameters& parameters) noexcept -> void {
+			m_parameters = parameters;
+		}
+
+		/// @brief Returns the timing, levels and shapes of the envelope
+		///
+		/// @return - The parameters
+		[[nodiscard]] constexpr inline auto get_parameters() const noexcept -> const Parameters& {
+			return m_parameters;
+		}
+
+		/// @brief Sets whether `note_on` continues a held note instead of restarting it
+		///
+		/// @param legato - Whether to use legato mode
+		constexpr inline auto set_legato(bool legato) noexcept -> void {
+			m_legato = legato;
+		}
+
+		/// @brief Returns whether `note_on` continues a held note instead of restarting it
+		///
+		/// @return - Whether this is in legato mode
+		[[nodiscard]] constexpr inline auto is_legato() const noexcept -> bool {
+			return m_legato;
+		}
+
+		/// @brief Sets the sample rate to process at. The stage in progress continues from the
+		/// same point in time at the new rate
+		///
+		/// @param sampleRate - The sample rate to process at
+		inline auto set_sample_rate(size_t sampleRate) noexcept -> void {
+			const auto previousRate = m_sample_rate;
+			m_sample_rate = sampleRate;
+			if(is_ramping()) {
+				std::visit(
+					[sampleRate](auto& interpolator) { interpolator.set_sample_rate(sampleRate); },
+					m_interpolator);
+			}
+			else if(m_hold_samples_remaining != std::numeric_limits<size_t>::max()
+					&& previousRate != 0ULL)
+			{
+				// round to the nearest sample at the new rate, keeping at least one
+				m_hold_samples_remaining = std::max<size_t>(
+					(m_hold_samples_remaining * sampleRate + previousRate / 2ULL) / previousRate,
+					1ULL);
+			}
+		}
+
+		constexpr auto operator=(const Envelope& envelope) noexcept -> Envelope& = default;
+		constexpr auto operator=(Envelope&& envelope) noexcept -> Envelope& = default;
+
+	  private:
+		Parameters m_parameters;
+		size_t m_sample_rate;
+		AnyInterpolator<T> m_interpolator = AnyInterpolator<T>();
+		/// The number of samples left in a holding stage. Idle and sustain last indefinitely
+		size_t m_hold_samples_remaining = std::numeric_limits<size_t>::max();
+		T m_value = gsl::narrow_cast<T>(0.0);
+		/// The value the ramping stage in progress ends on
+		T m_ramp_target = gsl::narrow_cast<T>(0.0);
+		EnvelopeStage m_stage = EnvelopeStage::Idle;
+		bool m_legato = false;
+
+		/// @brief Renders `buffer`, split at the boundaries between stages
+		///
+		/// @param buffer - The buffer to render into
+		/// @param renderRamp - Renders a ramping stage, `void(Interpolator&, std::span<T>)`
+		/// @param renderHold - Renders a holding stage, `void(std::span<T>, T value)`
+		///
+		/// @return - Whether all of `buffer` was rendered by a single holding stage
+		template<typename RenderRamp, typename RenderHold>
+		inline auto render(std::span<T> buffer,
+						   RenderRamp renderRamp,
+						   RenderHold renderHold) noexcept -> bool {
+			auto position = size_t(0);
+			auto constant = true;
+			while(position < buffer.size()) {
+				const auto remaining = buffer.size() - position;
+				if(is_ramping()) {
+					const auto rampRemaining = ramp_samples_remaining();
+					const auto length = std::min(remaining, rampRemaining);
+					// the ramp's last sample is the stage's target rather than the curve's end
+					// value, which logarithmic curves stop short of, so decay settles exactly on
+					// the sustain level and release reaches `0` without a jump
+					const auto finishes = length == rampRemaining;
+					const auto curveLength = finishes ? std::max<size_t>(length, 1ULL) - 1ULL
+													  : length;
+					if(curveLength != 0ULL) {
+						const auto segment = buffer.subspan(position, curveLength);
+						m_value = std::visit(
+							[segment, renderRamp](auto& interpolator) {
+								renderRamp(interpolator, segment);
+								return interpolator.get_current_value();
+							},
+							m_interpolator);
+					}
+					constant = false;
+					position += curveLength;
+					if(finishes) {
+						const auto targetLength = length - curveLength;
+						m_value = m_ramp_target;
+						renderHold(buffer.subspan(position, targetLength), m_value);
+						position += targetLength;
+						next_stage();
+					}
+				}
+				else {
+					const auto length = std::min(remaining, m_hold_samples_remaining);
+					renderHold(buffer.subspan(position, length), m_value);
+					constant = constant && length == buffer.size();
+					position += length;
+					m_hold_samples_remaining -= length;
+					if(m_hold_samples_remaining == 0ULL) {
+						next_stage();
+					}
+				}
+			}
+			return constant;
+		}
+
+		/// @brief Returns whether the current stage is rendered by `m_interpolator`
+		///
+		/// @return - Whether this is ramping
+		[[nodiscard]] constexpr inline auto is_ramping() const noexcept -> bool {
+			return m_stage == EnvelopeStage::Attack || m_stage == EnvelopeStage::Decay
+				   || m_stage == EnvelopeStage::Release;
+		}
+
+		/// @brief Returns the number of samples left in the current ramping stage
+		///
+		/// @return - The number of samples left
+		[[nodiscard]] inline auto ramp_samples_remaining() const noexcept -> size_t {
+			return std::visit(
+				[](const auto& interpolator) { return interpolator.samples_remaining(); },
+				m_interpolator);
+		}
+
+		/// @brief Moves on to the stage after the current one
+		inline auto next_stage() noexcept -> void {
+			switch(m_stage) {
+				case EnvelopeStage::Delay:
+					start_ramp(EnvelopeStage::Attack,
+							   PEAK_VALUE,
+							   m_parameters.attackSeconds,
+							   m_parameters.attackType);
+					break;
+				case EnvelopeStage::Attack:
+					start_hold(EnvelopeStage::Hold, m_parameters.holdSeconds);
+					break;
+				case EnvelopeStage::Hold:
+					start_ramp(EnvelopeStage::Decay,
+							   m_parameters.sustainLevel,
+							   m_parameters.decaySeconds,
+							   m_parameters.decayType);
+					break;
+				case EnvelopeStage::Decay:
+					m_stage = EnvelopeStage::Sustain;
+					m_hold_samples_remaining = std::numeric_limits<size_t>::max();
+					break;
+				case EnvelopeStage::Release: reset(); break;
+				case EnvelopeStage::Idle:
+				case EnvelopeStage::Sustain: break;
+			}
+		}
+
+		/// @brief Starts a stage that holds the current value for `seconds`, skipping it if
+		/// that is less than a sample
+		///
+		/// @param stage - The stage to start
+		/// @param seconds - The length of the stage
+		inline auto start_hold(EnvelopeStage stage, T seconds) noexcept -> void {
+			m_stage = stage;
+			m_hold_samples_remaining = samples_in(seconds);
+			if(m_hold_samples_remaining == 0ULL) {
+				next_stage();
+			}
+		}
+
+		/// @brief Starts a stage that ramps from the current value to `target` over `seconds`,
+		/// with the shape `type`. If that is less than a sample, jumps straight to `target`
+		///
+		/// @param stage - The stage to start
+		/// @param target - The value to ramp to
+		/// @param seconds - The length of the stage
+		/// @param type - The shape of the ramp
+		inline auto
+		start_ramp(EnvelopeStage stage, T target, T seconds, InterpolationType type) noexcept
+			-> void {
+			m_stage = stage;
+			if(samples_in(seconds) == 0ULL) {
+				m_value = target;
+				next_stage();
+				return;
+			}
+			m_ramp_target = target;
+			m_interpolator = make_interpolator(type, target, m_value, seconds, m_sample_rate);
+		}
+
+		/// @brief Returns the whole number of samples in `seconds`
+		///
+		/// @param seconds - The time to convert
+		///
+		/// @return - The number of samples
+		[[nodiscard]] constexpr inline auto samples_in(T seconds) const noexcept -> size_t {
+			return seconds > gsl::narrow_cast<T>(0.0)
+					   ? gsl::narrow_cast<size_t>(gsl::narrow_cast<T>(m_sample_rate) * seconds)
+					   : 0ULL;
+		}
+	};
+	IGNORE_PADDING_STOP
+} // namespace hyperion::math
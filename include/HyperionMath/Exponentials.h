@@ -1,19 +1,157 @@
 #pragma once
 
+#include <array>
+#include <bit>
 #include <cstdint>
+#include <limits>
+#include <span>
 
+#include "Constants.h"
 #include "General.h"
 #include "HyperionUtils/Concepts.h"
 
 namespace hyperion::math {
 
 #ifndef _MSC_VER
+	using std::int32_t;
+	using std::size_t;
 	using std::uint32_t;
 	using std::uint64_t;
 #endif
 
 	using utils::concepts::FloatingPoint;
 
+	namespace detail {
+		/// An exact unsigned integer, as little-endian 32-bit limbs, wide enough for 5^308 and
+		/// for `2^POW10_RECIPROCAL_SHIFT / 5^307` to keep well over 64 significant bits
+		using Pow10Integer = std::array<std::uint32_t, 26>;
+		/// The power of 2 the reciprocals of powers of 5 are scaled by to make them integers
+		inline constexpr int POW10_RECIPROCAL_SHIFT = 800;
+
+		/// @brief Multiplies `value` by 5, in place
+		///
+		/// @param value - The integer to multiply
+		inline constexpr auto multiply_by_5(Pow10Integer& value) noexcept -> void {
+			auto carry = std::uint64_t(0);
+			for(auto& limb : value) {
+				const auto product = static_cast<std::uint64_t>(limb) * 5U + carry;
+				limb = static_cast<std::uint32_t>(product);
+				carry = product >> 32U;
+			}
+		}
+
+		/// @brief Divides `value` by 5, in place, rounding down
+		///
+		/// @param value - The integer to divide
+		inline constexpr auto divide_by_5(Pow10Integer& value) noexcept -> void {
+			auto remainder = std::uint64_t(0);
+			for(auto i = value.size(); i > 0; --i) {
+				const auto dividend = (remainder << 32U) | value[i - 1];  // NOLINT
+				value[i - 1] = static_cast<std::uint32_t>(dividend / 5U); // NOLINT
+				remainder = dividend % 5U;
+			}
+		}
+
+		/// @brief Returns whether bit `index` of `value` is set
+		///
+		/// @param value - The integer
+		/// @param index - The index of the bit, from the least significant
+		/// @return - Whether the bit is set
+		[[nodiscard]] inline constexpr auto
+		is_bit_set(const Pow10Integer& value, int index) noexcept -> bool {
+			const auto position = static_cast<size_t>(index);
+			return ((value[position / 32U] >> (position % 32U)) & 1U) != 0U; // NOLINT
+		}
+
+		/// @brief Rounds `value * 2^exponent` to the nearest `T`, ties to even, which must be a
+		/// normal number
+		///
+		/// @param value - The integer part of the value; not zero
+		/// @param exponent - The power of 2 `value` is scaled by
+		/// @param inexact - Whether the true value is greater than `value`, i.e. `value` was
+		/// rounded down
+		/// @return - The correctly rounded value
+		template<FloatingPoint T>
+		[[nodiscard]] inline constexpr auto
+		round_to_nearest(const Pow10Integer& value, int exponent, bool inexact) noexcept -> T {
+			constexpr auto digits = std::numeric_limits<T>::digits;
+
+			auto length = static_cast<int>(value.size() * 32U);
+			while(!is_bit_set(value, length - 1)) {
+				--length;
+			}
+
+			// the `digits` most significant bits form the significand
+			auto significand = UIntOfSize<T>(0);
+			const auto lowest = length > digits ? length - digits : 0;
+			for(auto bit = length - 1; bit >= lowest; --bit) {
+				significand = (significand << 1U) | UIntOfSize<T>(is_bit_set(value, bit));
+			}
+			auto shift = lowest;
+			if(length < digits) {
+				significand <<= static_cast<unsigned>(digits - length);
+				shift = length - digits;
+			}
+
+			if(lowest > 0 && is_bit_set(value, lowest - 1)) {
+				auto sticky = inexact;
+				for(auto bit = lowest - 2; bit >= 0 && !sticky; --bit) {
+					sticky = is_bit_set(value, bit);
+				}
+				if(sticky || (significand & 1U) != 0U) {
+					++significand;
+					if(significand >> static_cast<unsigned>(digits) != 0U) {
+						significand >>= 1U;
+						++shift;
+					}
+				}
+			}
+
+			// the value is `significand * 2^(exponent + shift)`, with the significand's leading
+			// bit implicit in the representation
+			constexpr auto mantissaBits = static_cast<unsigned>(digits - 1);
+			const auto biasedExponent = static_cast<UIntOfSize<T>>(
+				exponent + shift + (digits - 1) + (std::numeric_limits<T>::max_exponent - 1));
+			const auto mantissa = significand & ((UIntOfSize<T>(1) << mantissaBits) - 1U);
+			return std::bit_cast<T>(static_cast<UIntOfSize<T>>(biasedExponent << mantissaBits)
+									| mantissa);
+		}
+
+		/// @brief Generates the table of powers of 10 in [10^MinExponent, 10^MaxExponent],
+		/// with every entry correctly rounded.
+		/// 10^n is 5^n * 2^n, so each positive power is rounded from the exact integer 5^n, and
+		/// each negative power from `2^POW10_RECIPROCAL_SHIFT / 5^n`, which is computed exactly
+		/// apart from a remainder that only ever makes it inexact
+		///
+		/// @tparam T - The floating point type of the table
+		/// @tparam MinExponent - The exponent of the first entry
+		/// @tparam MaxExponent - The exponent of the last entry
+		/// @return - The table of powers of 10
+		template<FloatingPoint T, int MinExponent, int MaxExponent>
+		[[nodiscard]] inline constexpr auto make_pow10_table() noexcept
+			-> std::array<T, static_cast<size_t>(MaxExponent - MinExponent + 1)> {
+			constexpr auto offset = static_cast<size_t>(-MinExponent);
+			auto table = std::array<T, static_cast<size_t>(MaxExponent - MinExponent + 1)>();
+
+			auto powerOf5 = Pow10Integer();
+			powerOf5[0] = 1U;
+			for(auto n = 0; n <= MaxExponent; ++n) {
+				table[offset + static_cast<size_t>(n)] = round_to_nearest<T>(powerOf5, n, false);
+				multiply_by_5(powerOf5);
+			}
+
+			auto reciprocal = Pow10Integer();
+			reciprocal[POW10_RECIPROCAL_SHIFT / 32] = 1U << (POW10_RECIPROCAL_SHIFT % 32);
+			for(auto n = 1; n <= -MinExponent; ++n) {
+				divide_by_5(reciprocal);
+				// 5^n never divides a power of 2, so the division always leaves a remainder
+				table[offset - static_cast<size_t>(n)]
+					= round_to_nearest<T>(reciprocal, -POW10_RECIPROCAL_SHIFT - n, true);
+			}
+			return table;
+		}
+	} // namespace detail
+
 	/// @brief Collection of approximations of various exponential functions
 	class Exponentials {
 	  public:
@@ -89,6 +227,87 @@ namespace hyperion::math {
 			}
 		}
 
+		/// @brief Fast approximation calculation of ln(x) for each value in `inputs`
+		/// @note Only the first `min(inputs.size(), out.size())` elements are processed
+		///
+		/// The logarithm kernels are branch-free and division-free, so the loop is vectorized with
+		/// whichever SIMD instruction set the target is compiled for
+		///
+		/// @param inputs - The values to calculate the natural logarithm of
+		/// @param out - The span to store the results in
+		inline static constexpr auto
+		ln(std::span<const float> inputs, std::span<float> out) noexcept -> void {
+			const auto size = General::min(inputs.size(), out.size());
+			for(size_t i = 0; i < size; ++i) {
+				out[i] = lnf_internal(inputs[i]);
+			}
+		}
+
+		/// @brief Fast approximation calculation of ln(x) for each value in `inputs`
+		/// @note Only the first `min(inputs.size(), out.size())` elements are processed
+		///
+		/// @param inputs - The values to calculate the natural logarithm of
+		/// @param out - The span to store the results in
+		inline static constexpr auto
+		ln(std::span<const double> inputs, std::span<double> out) noexcept -> void {
+			const auto size = General::min(inputs.size(), out.size());
+			for(size_t i = 0; i < size; ++i) {
+				out[i] = ln_internal(inputs[i]);
+			}
+		}
+
+		/// @brief Fast approximation calculation of log_2(x) for each value in `inputs`
+		/// @note Only the first `min(inputs.size(), out.size())` elements are processed
+		///
+		/// @param inputs - The values to calculate the base 2 logarithm of
+		/// @param out - The span to store the results in
+		inline static constexpr auto
+		log2(std::span<const float> inputs, std::span<float> out) noexcept -> void {
+			const auto size = General::min(inputs.size(), out.size());
+			for(size_t i = 0; i < size; ++i) {
+				out[i] = log2f_internal(inputs[i]);
+			}
+		}
+
+		/// @brief Fast approximation calculation of log_2(x) for each value in `inputs`
+		/// @note Only the first `min(inputs.size(), out.size())` elements are processed
+		///
+		/// @param inputs - The values to calculate the base 2 logarithm of
+		/// @param out - The span to store the results in
+		inline static constexpr auto
+		log2(std::span<const double> inputs, std::span<double> out) noexcept -> void {
+			const auto size = General::min(inputs.size(), out.size());
+			for(size_t i = 0; i < size; ++i) {
+				out[i] = log2_internal(inputs[i]);
+			}
+		}
+
+		/// @brief Fast approximation calculation of log_10(x) for each value in `inputs`
+		/// @note Only the first `min(inputs.size(), out.size())` elements are processed
+		///
+		/// @param inputs - The values to calculate the base 10 logarithm of
+		/// @param out - The span to store the results in
+		inline static constexpr auto
+		log10(std::span<const float> inputs, std::span<float> out) noexcept -> void {
+			const auto size = General::min(inputs.size(), out.size());
+			for(size_t i = 0; i < size; ++i) {
+				out[i] = log10f_internal(inputs[i]);
+			}
+		}
+
+		/// @brief Fast approximation calculation of log_10(x) for each value in `inputs`
+		/// @note Only the first `min(inputs.size(), out.size())` elements are processed
+		///
+		/// @param inputs - The values to calculate the base 10 logarithm of
+		/// @param out - The span to store the results in
+		inline static constexpr auto
+		log10(std::span<const double> inputs, std::span<double> out) noexcept -> void {
+			const auto size = General::min(inputs.size(), out.size());
+			for(size_t i = 0; i < size; ++i) {
+				out[i] = log10_internal(inputs[i]);
+			}
+		}
+
 		/// @brief Fast approximation calculation of 2^x
 		///
 		/// @param x - The exponent
@@ -133,7 +352,55 @@ namespace hyperion::math {
 			}
 		}
 
+		/// @brief Calculates x^N for the compile-time integer exponent `N`
+		///
+		/// This expands to a chain of multiplications via exponentiation by squaring,
+		/// e.g. x^8 is three multiplications, x^-2 is one multiplication and one division
+		///
+		/// @tparam N - The exponent
+		/// @param x - The base
+		/// @return - x^N
+		template<int N>
+		[[nodiscard]] inline static constexpr auto
+		pow(FloatingPoint auto x) noexcept -> decltype(x) {
+			using T = decltype(x);
+			if constexpr(N < 0) {
+				return static_cast<T>(1) / pow<-N>(x);
+			}
+			else if constexpr(N == 0) {
+				return static_cast<T>(1);
+			}
+			else if constexpr(N == 1) {
+				return x;
+			}
+			else if constexpr(N % 2 == 0) {
+				const auto half = pow<N / 2>(x);
+				return half * half;
+			}
+			else {
+				return x * pow<N - 1>(x);
+			}
+		}
+
 	  private :
+		/// Range of exponents (the normal range of `float`) in the `float` table of powers of 10
+		static constexpr int POW10_TABLE_MIN_EXPONENTF = -37;
+		static constexpr int POW10_TABLE_MAX_EXPONENTF = 38;
+		/// Range of exponents (the normal range of `double`) in the `double` table of powers of 10
+		static constexpr int POW10_TABLE_MIN_EXPONENT = -307;
+		static constexpr int POW10_TABLE_MAX_EXPONENT = 308;
+
+		/// Precomputed powers of 10 for the integral part of `pow10f`
+		static constexpr auto POW10_TABLEF
+			= detail::make_pow10_table<float,
+									   POW10_TABLE_MIN_EXPONENTF,
+									   POW10_TABLE_MAX_EXPONENTF>();
+		/// Precomputed powers of 10 for the integral part of `pow10`
+		static constexpr auto POW10_TABLE
+			= detail::make_pow10_table<double,
+									   POW10_TABLE_MIN_EXPONENT,
+									   POW10_TABLE_MAX_EXPONENT>();
+
 		  /// @brief Calculates the mantissa and exponent of `x`,
 		  /// in the representation x = mantissa * 2^exponent
 		  ///
@@ -144,11 +411,8 @@ namespace hyperion::math {
 		  /// @return - The mantissa
 		  [[nodiscard]] inline static constexpr auto
 		  frexpf_internal(float x, int* e) noexcept -> float {
-			union {
-				float f;
-				uint32_t i;
-			} y = {x};
-			auto ee = static_cast<int>(y.i >> 23U & 0xffU); // NOLINT
+			auto bits = std::bit_cast<uint32_t>(x);
+			auto ee = static_cast<int>(bits >> 23U & 0xffU);
 
 			if(!static_cast<bool>(ee)) {
 				if(static_cast<bool>(x)) {
@@ -165,9 +429,9 @@ namespace hyperion::math {
 			}
 
 			*e = ee - 0x7e;
-			y.i &= 0x807fffffUL; // NOLINT
-			y.i |= 0x3f000000UL; // NOLINT
-			return y.f;			 // NOLINT
+			bits &= 0x807fffffU;
+			bits |= 0x3f000000U;
+			return std::bit_cast<float>(bits);
 		}
 
 		/// @brief Helper function for `expf`; Don't use on its own
@@ -184,33 +448,112 @@ namespace hyperion::math {
 
 		/// @brief Fast approximiation calculation of e^x
 		///
+		/// Splits x into n * ln(2) + r, evaluates the Pade approximation on r, and constructs 2^n
+		/// directly in the exponent bits, so the cost is the same for every input
+		///
 		/// @param x - The exponent
 		/// @return - e^x
 		[[nodiscard]] inline static constexpr auto expf_internal(float x) noexcept -> float {
-			const auto condition = x < -3.0F || x > 2.0F;
-			if(condition) {
-				const auto multiplier
-					= static_cast<float>(x < 0.0F)
-						  * 0.1353352832366126918939994949724844034076315459095758814681588726F
-					  + static_cast<float>(x >= 0.0F)
-							* 7.3890560989306502272304274605750078131803155705518473240871278225F;
-				const auto subtractor
-					= static_cast<float>(x < 0.0F) * -2.0F + static_cast<float>(x > 0.0F) * 2.0F;
-				return expf_internal(x - subtractor) * multiplier;
-			}
-			else {
-				return exp_helperf(x);
-			}
+			constexpr auto log2e = 1.4426950408889634073599246810018921F;
+			// ln(2) split in two parts (Cody-Waite), so n * ln2Hi is exact
+			constexpr auto ln2Hi = 0.693359375F;
+			constexpr auto ln2Lo = -2.12194440e-4F;
+			// ln(FLT_MIN) and ln(FLT_MAX): outside of these e^x isn't a normal float
+			constexpr auto minInput = -87.3365447505530F;
+			constexpr auto maxInput = 88.7228391116729F;
+
+			// n = round(x / ln(2)), clamped so that 2^n has a valid (normal) exponent field.
+			// This keeps |r| <= ln(2) / 2 for most inputs, and always within the accurate range
+			// of `exp_helperf`
+			const auto scaled = x * log2e;
+			const auto clamped = scaled > -126.0F ? (scaled < 127.0F ? scaled : 127.0F) : -126.0F;
+			const auto biasedExponent = static_cast<uint32_t>(clamped + 127.5F);
+			const auto n = static_cast<float>(biasedExponent) - 127.0F;
+			const auto r = (x - n * ln2Hi) - n * ln2Lo;
+			const auto result = exp_helperf(r) * std::bit_cast<float>(biasedExponent << 23U);
+
+			return x < minInput ? 0.0F : (x > maxInput ? Constants<float>::infinity : result);
 		}
 
-		/// @brief Helper function to lnf. Performs ln(x + 1), accurate in -0.8 <= x <= 5
+		/// @brief Helper function for the logarithms; Don't use on its own
+		///
+		/// Decomposes `x` into 2^exponent * (1 + f), with 1 + f in [sqrt(0.5), sqrt(2)), by
+		/// extracting the exponent bits directly (like `frexp`). Handles subnormal `x`.
+		///
+		/// All selection is done on the integer representation, so loops over this
+		/// vectorize without needing to relax floating point trapping semantics
+		///
+		/// @param x - The value to decompose. Must be > 0
+		/// @param exponent - The `float` to store the exponent in
+		/// @return - f, the mantissa minus 1
+		[[nodiscard]] inline static constexpr auto
+		log_decomposef(float x, float* exponent) noexcept -> float {
+			// the mantissa bits of sqrt(0.5)
+			constexpr auto sqrtHalfMantissa = 0x003504f3U;
+
+			// scale subnormals by 2^23 to bring them into the normal range
+			const auto subnormal = static_cast<uint32_t>(std::bit_cast<uint32_t>(x) < 0x00800000U);
+			const auto scale = std::bit_cast<float>(0x3f800000U + (subnormal * 23U << 23U));
+			const auto bits = std::bit_cast<uint32_t>(x * scale);
+			const auto mantissaBits = bits & 0x007fffffU;
+			// x = mantissa * 2^e, mantissa in [0.5, 1), but shift the mantissa to
+			// [sqrt(0.5), sqrt(2)) to center f on 0
+			const auto shift = static_cast<uint32_t>(mantissaBits < sqrtHalfMantissa);
+			const auto mantissa
+				= std::bit_cast<float>(mantissaBits | (0x3f000000U + (shift << 23U)));
+			const auto e = static_cast<int32_t>(bits >> 23U & 0xffU)
+						   - static_cast<int32_t>(126U + subnormal * 23U + shift);
+			*exponent = static_cast<float>(e);
+			return mantissa - 1.0F;
+		}
+
+		/// @brief Helper function for the logarithms. Performs ln(x + 1), accurate in
+		/// [sqrt(0.5) - 1, sqrt(2) - 1]
+		///
+		/// This is the Cephes `logf` polynomial, so is division-free
 		///
 		/// @param x The input
 		/// @return - ln(x + 1)
 		[[nodiscard]] inline static constexpr auto lnXPlus1f(float x) noexcept -> float {
-			auto numerator = x * (7560 + x * (15120 + x * (9870 + x * (2310 + x * 137))));
-			auto denominator = 7560 + x * (18900 + x * (16800 + x * (6300 + x * (900 + 30 * x))));
-			return numerator / denominator;
+			constexpr float c1 = 3.3333331174E-1F;
+			constexpr float c2 = -2.4999993993E-1F;
+			constexpr float c3 = 2.0000714765E-1F;
+			constexpr float c4 = -1.6668057665E-1F;
+			constexpr float c5 = 1.4249322787E-1F;
+			constexpr float c6 = -1.2420140846E-1F;
+			constexpr float c7 = 1.1676998740E-1F;
+			constexpr float c8 = -1.1514610310E-1F;
+			constexpr float c9 = 7.0376836292E-2F;
+
+			const auto x2 = x * x; // The input argument squared
+
+			const auto highOrderTerms = c5 + x * (c6 + x * (c7 + x * (c8 + x * c9)));
+			const auto polynomial = c1 + x * (c2 + x * (c3 + x * (c4 + x * highOrderTerms)));
+			return x + (x * x2 * polynomial - 0.5F * x2);
+		}
+
+		/// @brief Handles the special cases of the logarithms; Don't use on its own
+		///
+		/// @param x - The input to the logarithm
+		/// @param result - The result of the approximation for `x`
+		/// @return - `result` if `x` is positive and finite, otherwise the special value for `x`
+		[[nodiscard]] inline static constexpr auto
+		log_special_casesf(float x, float result) noexcept -> float {
+			constexpr auto infinityBits = 0x7f800000U;
+			constexpr auto negativeInfinityBits = 0xff800000U;
+			constexpr auto nanBits = 0x7fc00000U;
+
+			// log(x > 0) = result or +inf, log(x < 0) = NaN, log(0) = -inf, log(NaN) = NaN
+			// selected on the bit patterns, with a mask, so this stays branch-free
+			const auto bits = std::bit_cast<uint32_t>(x);
+			const auto isZero = (bits & 0x7fffffffU) == 0U;
+			const auto isNegativeOrNaN = bits > infinityBits;
+			const auto isInfinity = bits == infinityBits;
+			const auto special
+				= isZero ? negativeInfinityBits : (isNegativeOrNaN ? nanBits : infinityBits);
+			const auto mask = 0U - static_cast<uint32_t>(isZero | isNegativeOrNaN | isInfinity);
+			return std::bit_cast<float>((std::bit_cast<uint32_t>(result) & ~mask)
+										| (special & mask));
 		}
 
 		/// @brief Fast approximation calculation of ln(x)
@@ -218,16 +561,14 @@ namespace hyperion::math {
 		/// @param x - The input
 		/// @return - ln(x)
 		[[nodiscard]] inline static constexpr auto lnf_internal(float x) noexcept -> float {
-			// subtract one, because we'll be using an ln(x + 1) approximation
-			float in = x - 1.0F;
-			// if we're outside the accurate range, we'll reduce to the accurate range
-			auto condition = static_cast<float>(in >= 5.0F || in <= -0.5F);
-			auto divVal = in >= 5.0F ? 5.0F : (in <= -0.5F ? -0.5F : 1.0F);
-			// if outside the accurate range, reduce to the accurate range and then perform the
-			// approximation
-			return condition
-					   * (lnXPlus1f(((in + 1.0F) / (divVal + 1.0F)) - 1.0F) + lnXPlus1f(divVal))
-				   + (1.0F - condition) * lnXPlus1f(in);
+			// ln(2) split in two parts (Cody-Waite), so exponent * ln2Hi is exact
+			constexpr auto ln2Hi = 0.693359375F;
+			constexpr auto ln2Lo = -2.12194440e-4F;
+
+			auto exponent = 0.0F;
+			const auto f = log_decomposef(x, &exponent);
+			// ln(2^exponent * (1 + f)) = exponent * ln(2) + ln(1 + f)
+			return log_special_casesf(x, (lnXPlus1f(f) + exponent * ln2Lo) + exponent * ln2Hi);
 		}
 
 		/// @brief Fast approximation calculation of log_2(x)
@@ -235,8 +576,12 @@ namespace hyperion::math {
 		/// @param x - The input
 		/// @return - log_2(x)
 		[[nodiscard]] inline static constexpr auto log2f_internal(float x) noexcept -> float {
-			return lnf_internal(x)
-				   / 0.6931471805599453094172321214581765680755001343602552541206800094F;
+			constexpr auto log2e = 1.4426950408889634073599246810018921F;
+
+			auto exponent = 0.0F;
+			const auto f = log_decomposef(x, &exponent);
+			// log_2(2^exponent * (1 + f)) = exponent + ln(1 + f) * log_2(e)
+			return log_special_casesf(x, lnXPlus1f(f) * log2e + exponent);
 		}
 
 		/// @brief Fast approximation calculation of log_10(x)
@@ -244,80 +589,60 @@ namespace hyperion::math {
 		/// @param x - The input
 		/// @return - log_10(x)
 		[[nodiscard]] inline static constexpr auto log10f_internal(float x) noexcept -> float {
-			return lnf_internal(x)
-				   / 2.3025850929940456840179914546843642076011014886287729760333279009F;
+			constexpr auto log10e = 0.4342944819032518276511289189166050F;
+			constexpr auto log10of2 = 0.3010299956639811952137388947244930F;
+
+			auto exponent = 0.0F;
+			const auto f = log_decomposef(x, &exponent);
+			// log_10(2^exponent * (1 + f)) = exponent * log_10(2) + ln(1 + f) * log_10(e)
+			return log_special_casesf(x, lnXPlus1f(f) * log10e + exponent * log10of2);
 		}
 
 		/// @brief Fast approximation calculation of 2^x
 		///
+		/// Splits x into n + f, with n the nearest integer, constructs 2^n directly in the exponent
+		/// bits and approximates 2^f = e^(f * ln(2)).
+		/// For integral x, f is 0 and the result is exactly 2^x
+		///
 		/// @param x - The exponent
 		/// @return 2^x
 		[[nodiscard]] inline static constexpr auto pow2f_internal(float x) noexcept -> float {
-			auto integer = static_cast<int>(x);
-			if(x < 0.0F) {
-				if(General::abs(static_cast<float>(integer) - x) > 0) {
-					return expf_internal(
-						x * 0.6931471805599453094172321214581765680755001343602552541206800094F);
-				}
-				else {
-					auto out = 2;
-					for(int i = 1; i < General::abs(integer); ++i) {
-						out *= 2;
-					}
-					return 1.0F / static_cast<float>(out);
-				}
-			}
-			else if(x - static_cast<float>(integer) > 0) {
-				return expf_internal(
-					x * 0.6931471805599453094172321214581765680755001343602552541206800094F);
-			}
-			else if(x == 0.0F) {
-				return 1.0F;
-			}
-			else {
-				auto out = 2;
-				for(int i = 1; i < integer; ++i) {
-					out *= 2;
-				}
+			constexpr auto ln2 = 0.6931471805599453094172321214581765F;
 
-				return static_cast<float>(out);
-			}
+			// n = round(x), clamped so that 2^n has a valid (normal) exponent field
+			const auto clamped = x > -126.0F ? (x < 127.0F ? x : 127.0F) : -126.0F;
+			const auto biasedExponent = static_cast<uint32_t>(clamped + 127.5F);
+			const auto fraction = x - (static_cast<float>(biasedExponent) - 127.0F);
+			const auto result
+				= exp_helperf(fraction * ln2) * std::bit_cast<float>(biasedExponent << 23U);
+
+			return x < -126.0F ? 0.0F : (x >= 128.0F ? Constants<float>::infinity : result);
 		}
 
 		/// @brief Fast approximation calculation of 10^x
 		///
+		/// Splits x into n + f, with n the nearest integer, looks up 10^n in a precomputed table
+		/// and approximates 10^f = e^(f * ln(10)) with `exp`.
+		/// For integral x, f is 0 and the result is just the table entry
+		///
 		/// @param x - The exponent
 		/// @return 10^x
 		[[nodiscard]] inline static constexpr auto pow10f_internal(float x) noexcept -> float {
-			auto integer = static_cast<int>(x);
-			if(x < 0.0F) {
-				if(x - static_cast<float>(integer) < 0) {
-					return expf_internal(
-						x * 2.3025850929940456840179914546843642076011014886287729760333279009F);
-				}
-				else {
-					auto out = 10;
-					for(int i = 1; i < -integer; ++i) {
-						out *= 10;
-					}
-					return 1.0F / static_cast<float>(out);
-				}
-			}
-			else if(x - static_cast<float>(integer) > 0) {
-				return expf_internal(
-					x * 2.3025850929940456840179914546843642076011014886287729760333279009F);
-			}
-			else if(x == 0.0F) {
-				return 1.0F;
-			}
-			else {
-				auto out = 10;
-				for(int i = 1; i < integer; ++i) {
-					out *= 10;
-				}
-
-				return static_cast<float>(out);
-			}
+			constexpr auto ln10 = 2.3025850929940456840179914546843642F;
+			constexpr auto minExponent = static_cast<float>(POW10_TABLE_MIN_EXPONENTF);
+			constexpr auto maxExponent = static_cast<float>(POW10_TABLE_MAX_EXPONENTF);
+
+			// n = round(x), clamped to the range of the table
+			const auto clamped
+				= x > minExponent ? (x < maxExponent ? x : maxExponent) : minExponent;
+			const auto index = static_cast<size_t>(clamped - minExponent + 0.5F);
+			const auto fraction = x - (static_cast<float>(index) + minExponent);
+			const auto result = expf_internal(fraction * ln10) * POW10_TABLEF[index]; // NOLINT
+
+			// log_10(FLT_MAX); above this 10^x isn't representable as a float
+			constexpr auto maxInput = 38.5318394191036F;
+			return x < minExponent - 0.5F ? 0.0F
+										  : (x > maxInput ? Constants<float>::infinity : result);
 		}
 
 		/// @brief Fast approximation calculation of base^exponent
@@ -338,11 +663,8 @@ namespace hyperion::math {
 		/// @return - The mantissa
 		[[nodiscard]] inline static constexpr auto
 		frexp_internal(double x, int* e) noexcept -> double {
-			union {
-				double d;
-				uint64_t i;
-			} y = {x};
-			auto ee = static_cast<int>(y.i >> 52U & 0x7ffU); // NOLINT
+			auto bits = std::bit_cast<uint64_t>(x);
+			auto ee = static_cast<int>(bits >> 52U & 0x7ffU);
 
 			if(!static_cast<bool>(ee)) {
 				if(static_cast<bool>(x)) {
@@ -359,9 +681,9 @@ namespace hyperion::math {
 			}
 
 			*e = ee - 0x3fe;
-			y.i &= 0x800fffffffffffffULL; // NOLINT
-			y.i |= 0x3fe0000000000000ULL; // NOLINT
-			return y.d;					  // NOLINT
+			bits &= 0x800fffffffffffffULL;
+			bits |= 0x3fe0000000000000ULL;
+			return std::bit_cast<double>(bits);
 		}
 
 		/// @brief Helper function for `exp`; Don't use on its own
@@ -376,33 +698,131 @@ namespace hyperion::math {
 
 		/// @brief Fast approximiation calculation of e^x
 		///
+		/// Splits x into n * ln(2) + r, evaluates the Pade approximation on r, and constructs 2^n
+		/// directly in the exponent bits, so the cost is the same for every input
+		///
 		/// @param x - The exponent
 		/// @return - e^x
 		[[nodiscard]] inline static constexpr auto exp_internal(double x) noexcept -> double {
-			const auto condition = x < -3.0 || x > 2.0;
-			if(condition) {
-				const auto multiplier
-					= static_cast<double>(x < 0.0)
-						  * 0.1353352832366126918939994949724844034076315459095758814681588726
-					  + static_cast<double>(x >= 0.0)
-							* 7.3890560989306502272304274605750078131803155705518473240871278225;
-				const auto subtractor
-					= static_cast<double>(x < 0.0) * -2.0 + static_cast<double>(x > 0.0) * 2.0;
-				return exp_internal(x - subtractor) * multiplier;
-			}
-			else {
-				return exp_helper(x);
-			}
+			constexpr auto log2e = 1.4426950408889634073599246810018921;
+			// ln(2) split in two parts (Cody-Waite), so n * ln2Hi is exact
+			constexpr auto ln2Hi = 6.93145751953125E-1;
+			constexpr auto ln2Lo = 1.42860682030941723212E-6;
+			// ln(DBL_MIN) and ln(DBL_MAX): outside of these e^x isn't a normal double
+			constexpr auto minInput = -708.396418532264106;
+			constexpr auto maxInput = 709.782712893383973;
+
+			// n = round(x / ln(2)), clamped so that 2^n has a valid (normal) exponent field.
+			// This keeps |r| <= ln(2) / 2 for most inputs, and always within the accurate range
+			// of `exp_helper`
+			const auto scaled = x * log2e;
+			const auto clamped
+				= scaled > -1022.0 ? (scaled < 1023.0 ? scaled : 1023.0) : -1022.0;
+			const auto biasedExponent = static_cast<uint64_t>(clamped + 1023.5);
+			const auto n = static_cast<double>(biasedExponent) - 1023.0;
+			const auto r = (x - n * ln2Hi) - n * ln2Lo;
+			const auto result = exp_helper(r) * std::bit_cast<double>(biasedExponent << 52U);
+
+			return x < minInput ? 0.0 : (x > maxInput ? Constants<double>::infinity : result);
+		}
+
+		/// @brief Helper function for the logarithms; Don't use on its own
+		///
+		/// Decomposes `x` into 2^exponent * (1 + f), with 1 + f in [sqrt(0.5), sqrt(2)), by
+		/// extracting the exponent bits directly (like `frexp`). Handles subnormal `x`.
+		///
+		/// All selection is done on the integer representation, so loops over this
+		/// vectorize without needing to relax floating point trapping semantics
+		///
+		/// @param x - The value to decompose. Must be > 0
+		/// @param exponent - The `double` to store the exponent in
+		/// @return - f, the mantissa minus 1
+		[[nodiscard]] inline static constexpr auto
+		log_decompose(double x, double* exponent) noexcept -> double {
+			// the mantissa bits of sqrt(0.5)
+			constexpr auto sqrtHalfMantissa = 0x0006a09e667f3bcdULL;
+
+			// scale subnormals by 2^52 to bring them into the normal range
+			const auto subnormal
+				= static_cast<uint64_t>(std::bit_cast<uint64_t>(x) < 0x0010000000000000ULL);
+			const auto scale
+				= std::bit_cast<double>(0x3ff0000000000000ULL + (subnormal * 52U << 52U));
+			const auto bits = std::bit_cast<uint64_t>(x * scale);
+			const auto mantissaBits = bits & 0x000fffffffffffffULL;
+			// x = mantissa * 2^e, mantissa in [0.5, 1), but shift the mantissa to
+			// [sqrt(0.5), sqrt(2)) to center f on 0
+			const auto shift = static_cast<uint64_t>(mantissaBits < sqrtHalfMantissa);
+			const auto mantissa
+				= std::bit_cast<double>(mantissaBits | (0x3fe0000000000000ULL + (shift << 52U)));
+			// int32_t, because not every target can vectorize int64_t -> double conversion
+			const auto e = static_cast<int32_t>(bits >> 52U & 0x7ffU)
+						   - static_cast<int32_t>(1022U + subnormal * 52U + shift);
+			*exponent = static_cast<double>(e);
+			return mantissa - 1.0;
 		}
 
-		/// @brief Helper function to ln. Performs ln(x + 1), accurate in -0.8 <= x <= 5
+		/// @brief Helper function for the logarithms. Performs ln(x + 1), accurate in
+		/// [sqrt(0.5) - 1, sqrt(2) - 1]
+		///
+		/// ln(x + 1) = x - x^2 / 2 + x^3 * P(x), where P is a near-minimax (Chebyshev node)
+		/// polynomial fit, so this is division-free
 		///
 		/// @param x The input
 		/// @return - ln(x + 1)
 		[[nodiscard]] inline static constexpr auto lnXPlus1(double x) noexcept -> double {
-			auto numerator = x * (7560 + x * (15120 + x * (9870 + x * (2310 + x * 137))));
-			auto denominator = 7560 + x * (18900 + x * (16800 + x * (6300 + x * (900 + 30 * x))));
-			return numerator / denominator;
+			constexpr double c1 = 0.3333333333333333;
+			constexpr double c2 = -0.24999999999998596;
+			constexpr double c3 = 0.20000000000003482;
+			constexpr double c4 = -0.16666666667365992;
+			constexpr double c5 = 0.14285714285634818;
+			constexpr double c6 = -0.12499999898432576;
+			constexpr double c7 = 0.11111111008787179;
+			constexpr double c8 = -0.10000006590426393;
+			constexpr double c9 = 0.09090921076038966;
+			constexpr double c10 = -0.08333110642999564;
+			constexpr double c11 = 0.07691741139835176;
+			constexpr double c12 = -0.07146922611081985;
+			constexpr double c13 = 0.06680348247882924;
+			constexpr double c14 = -0.06213325491398715;
+			constexpr double c15 = 0.05706613674459082;
+			constexpr double c16 = -0.056358573946071716;
+			constexpr double c17 = 0.06362025303018654;
+			constexpr double c18 = -0.059591730189431036;
+			constexpr double c19 = 0.027053075892336395;
+
+			const auto x2 = x * x; // The input argument squared
+
+			const auto topTerms
+				= c13 + x * (c14 + x * (c15 + x * (c16 + x * (c17 + x * (c18 + x * c19)))));
+			const auto highOrderTerms
+				= c7 + x * (c8 + x * (c9 + x * (c10 + x * (c11 + x * (c12 + x * topTerms)))));
+			const auto polynomial
+				= c1 + x * (c2 + x * (c3 + x * (c4 + x * (c5 + x * (c6 + x * highOrderTerms)))));
+			return x + (x * x2 * polynomial - 0.5 * x2);
+		}
+
+		/// @brief Handles the special cases of the logarithms; Don't use on its own
+		///
+		/// @param x - The input to the logarithm
+		/// @param result - The result of the approximation for `x`
+		/// @return - `result` if `x` is positive and finite, otherwise the special value for `x`
+		[[nodiscard]] inline static constexpr auto
+		log_special_cases(double x, double result) noexcept -> double {
+			constexpr auto infinityBits = 0x7ff0000000000000ULL;
+			constexpr auto negativeInfinityBits = 0xfff0000000000000ULL;
+			constexpr auto nanBits = 0x7ff8000000000000ULL;
+
+			// log(x > 0) = result or +inf, log(x < 0) = NaN, log(0) = -inf, log(NaN) = NaN
+			// selected on the bit patterns, with a mask, so this stays branch-free
+			const auto bits = std::bit_cast<uint64_t>(x);
+			const auto isZero = (bits & 0x7fffffffffffffffULL) == 0ULL;
+			const auto isNegativeOrNaN = bits > infinityBits;
+			const auto isInfinity = bits == infinityBits;
+			const auto special
+				= isZero ? negativeInfinityBits : (isNegativeOrNaN ? nanBits : infinityBits);
+			const auto mask = 0ULL - static_cast<uint64_t>(isZero | isNegativeOrNaN | isInfinity);
+			return std::bit_cast<double>((std::bit_cast<uint64_t>(result) & ~mask)
+										 | (special & mask));
 		}
 
 		/// @brief Fast approximation calculation of ln(x)
@@ -410,15 +830,14 @@ namespace hyperion::math {
 		/// @param x - The input
 		/// @return - ln(x)
 		[[nodiscard]] inline static constexpr auto ln_internal(double x) noexcept -> double {
-			// subtract one, because we'll be using an ln(x + 1) approximation
-			double in = x - 1.0;
-			// if we're outside the accurate range, we'll reduce to the accurate range
-			auto condition = static_cast<double>(in >= 5.0 || in <= -0.5);
-			auto divVal = in >= 5.0 ? 5.0 : (in <= -0.5 ? -0.5 : 1.0);
-			// if outside the accurate range, reduce to the accurate range and then perform the
-			// approximation, otherwise, just perform the approximation 2.2302585 = ln(10)
-			return condition * (lnXPlus1(((in + 1.0) / (divVal + 1.0)) - 1.0) + lnXPlus1(divVal))
-				   + (1.0 - condition) * lnXPlus1(in);
+			// ln(2) split in two parts (Cody-Waite), so exponent * ln2Hi is exact
+			constexpr auto ln2Hi = 6.93145751953125E-1;
+			constexpr auto ln2Lo = 1.42860682030941723212E-6;
+
+			auto exponent = 0.0;
+			const auto f = log_decompose(x, &exponent);
+			// ln(2^exponent * (1 + f)) = exponent * ln(2) + ln(1 + f)
+			return log_special_cases(x, (lnXPlus1(f) + exponent * ln2Lo) + exponent * ln2Hi);
 		}
 
 		/// @brief Fast approximation calculation of log_2(x)
@@ -426,8 +845,12 @@ namespace hyperion::math {
 		/// @param x - The input
 		/// @return - log_2(x)
 		[[nodiscard]] inline static constexpr auto log2_internal(double x) noexcept -> double {
-			return ln_internal(x)
-				   / 0.6931471805599453094172321214581765680755001343602552541206800094;
+			constexpr auto log2e = 1.4426950408889634073599246810018921;
+
+			auto exponent = 0.0;
+			const auto f = log_decompose(x, &exponent);
+			// log_2(2^exponent * (1 + f)) = exponent + ln(1 + f) * log_2(e)
+			return log_special_cases(x, lnXPlus1(f) * log2e + exponent);
 		}
 
 		/// @brief Fast approximation calculation of log_10(x)
@@ -435,80 +858,60 @@ namespace hyperion::math {
 		/// @param x - The input
 		/// @return - log_10(x)
 		[[nodiscard]] inline static constexpr auto log10_internal(double x) noexcept -> double {
-			return ln_internal(x)
-				   / 2.3025850929940456840179914546843642076011014886287729760333279009;
+			constexpr auto log10e = 0.4342944819032518276511289189166050;
+			constexpr auto log10of2 = 0.3010299956639811952137388947244930;
+
+			auto exponent = 0.0;
+			const auto f = log_decompose(x, &exponent);
+			// log_10(2^exponent * (1 + f)) = exponent * log_10(2) + ln(1 + f) * log_10(e)
+			return log_special_cases(x, lnXPlus1(f) * log10e + exponent * log10of2);
 		}
 
 		/// @brief Fast approximation calculation of 2^x
 		///
+		/// Splits x into n + f, with n the nearest integer, constructs 2^n directly in the exponent
+		/// bits and approximates 2^f = e^(f * ln(2)).
+		/// For integral x, f is 0 and the result is exactly 2^x
+		///
 		/// @param x - The exponent
 		/// @return 2^x
 		[[nodiscard]] inline static constexpr auto pow2_internal(double x) noexcept -> double {
-			auto integer = static_cast<int>(x);
-			if(x < 0.0) {
-				if(x - static_cast<double>(integer) < 0) {
-					return exp_internal(
-						x * 0.6931471805599453094172321214581765680755001343602552541206800094);
-				}
-				else {
-					auto out = 2;
-					for(int i = 1; i < -integer; ++i) {
-						out *= 2;
-					}
-					return 1.0 / static_cast<double>(out);
-				}
-			}
-			else if(x - static_cast<double>(integer) > 0) {
-				return exp_internal(
-					x * 0.6931471805599453094172321214581765680755001343602552541206800094);
-			}
-			else if(x == 0.0) {
-				return 1.0;
-			}
-			else {
-				auto out = 2;
-				for(int i = 1; i < integer; ++i) {
-					out *= 2;
-				}
+			constexpr auto ln2 = 0.6931471805599453094172321214581765;
 
-				return static_cast<double>(out);
-			}
+			// n = round(x), clamped so that 2^n has a valid (normal) exponent field
+			const auto clamped = x > -1022.0 ? (x < 1023.0 ? x : 1023.0) : -1022.0;
+			const auto biasedExponent = static_cast<uint64_t>(clamped + 1023.5);
+			const auto fraction = x - (static_cast<double>(biasedExponent) - 1023.0);
+			const auto result
+				= exp_helper(fraction * ln2) * std::bit_cast<double>(biasedExponent << 52U);
+
+			return x < -1022.0 ? 0.0 : (x >= 1024.0 ? Constants<double>::infinity : result);
 		}
 
 		/// @brief Fast approximation calculation of 10^x
 		///
+		/// Splits x into n + f, with n the nearest integer, looks up 10^n in a precomputed table
+		/// and approximates 10^f = e^(f * ln(10)) with `exp`.
+		/// For integral x, f is 0 and the result is just the table entry
+		///
 		/// @param x - The exponent
 		/// @return 10^x
 		[[nodiscard]] inline static constexpr auto pow10_internal(double x) noexcept -> double {
-			auto integer = static_cast<int>(x);
-			if(x < 0.0) {
-				if(x - static_cast<double>(integer) < 0) {
-					return exp_internal(
-						x * 2.3025850929940456840179914546843642076011014886287729760333279009);
-				}
-				else {
-					auto out = 10;
-					for(int i = 1; i < -integer; ++i) {
-						out *= 10;
-					}
-					return 1.0 / static_cast<double>(out);
-				}
-			}
-			else if(x - static_cast<double>(integer) > 0) {
-				return exp_internal(
-					x * 2.3025850929940456840179914546843642076011014886287729760333279009);
-			}
-			else if(x == 0.0) {
-				return 1.0;
-			}
-			else {
-				auto out = 10;
-				for(int i = 1; i < integer; ++i) {
-					out *= 10;
-				}
-
-				return static_cast<double>(out);
-			}
+			constexpr auto ln10 = 2.3025850929940456840179914546843642;
+			constexpr auto minExponent = static_cast<double>(POW10_TABLE_MIN_EXPONENT);
+			constexpr auto maxExponent = static_cast<double>(POW10_TABLE_MAX_EXPONENT);
+
+			// n = round(x), clamped to the range of the table
+			const auto clamped
+				= x > minExponent ? (x < maxExponent ? x : maxExponent) : minExponent;
+			const auto index = static_cast<size_t>(clamped - minExponent + 0.5);
+			const auto fraction = x - (static_cast<double>(index) + minExponent);
+			const auto result = exp_internal(fraction * ln10) * POW10_TABLE[index]; // NOLINT
+
+			// log_10(DBL_MAX); above this 10^x isn't representable as a double
+			constexpr auto maxInput = 308.254715559916743;
+			return x < minExponent - 0.5 ? 0.0
+										 : (x > maxInput ? Constants<double>::infinity : result);
 		}
 
 		/// @brief Fast approximation calculation of base^exponent
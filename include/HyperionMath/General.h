@@ -1,16 +1,36 @@
 #pragma once
 
+#include <bit>
+#include <cmath>
 #include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
 
 #include "HyperionUtils/Concepts.h"
 
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+	#define HYPERION_MATH_HAS_SSE 1
+	#include <xmmintrin.h>
+#else
+	#define HYPERION_MATH_HAS_SSE 0
+#endif
+
 namespace hyperion::math {
 #ifndef _MSC_VER
 	using std::int32_t;
 	using std::size_t;
+	using std::uint32_t;
+	using std::uint64_t;
 #endif //_MSC_VER
 
 	using utils::concepts::Numeric, utils::concepts::FloatingPoint;
+
+	/// @brief The unsigned integer type with the same size as the floating point type `T`
+	template<FloatingPoint T>
+	using UIntOfSize
+		= std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+
 	class General {
 	  public:
 		/// @brief Calculates the maximum of the two values
@@ -43,7 +63,10 @@ namespace hyperion::math {
 			return x * sign;
 		}
 
-		/// @brief Fast approximation calculation of the square root of the given value
+		/// @brief Calculates the square root of the given value
+		///
+		/// Uses the hardware square root at runtime and an iterative, `constexpr` friendly
+		/// calculation during constant evaluation
 		///
 		/// @param x - The value to take the square root of
 		/// @return - The square root of x
@@ -57,6 +80,126 @@ namespace hyperion::math {
 			}
 		}
 
+		/// @brief Calculates the square root of each of the given values
+		///
+		/// Processes `min(inputs.size(), out.size())` elements
+		///
+		/// @param inputs - The values to take the square root of
+		/// @param out - The span to store the results in
+		inline static constexpr auto
+		sqrt(std::span<const float> inputs, std::span<float> out) noexcept -> void {
+			const auto size = min(inputs.size(), out.size());
+			for(size_t i = 0; i < size; ++i) {
+				out[i] = sqrtf_internal(inputs[i]);
+			}
+		}
+
+		/// @brief Calculates the square root of each of the given values
+		///
+		/// Processes `min(inputs.size(), out.size())` elements
+		///
+		/// @param inputs - The values to take the square root of
+		/// @param out - The span to store the results in
+		inline static constexpr auto
+		sqrt(std::span<const double> inputs, std::span<double> out) noexcept -> void {
+			const auto size = min(inputs.size(), out.size());
+			for(size_t i = 0; i < size; ++i) {
+				out[i] = sqrt_internal(inputs[i]);
+			}
+		}
+
+		/// @brief The number of Newton steps `rsqrt` refines its estimate with for `T` when none
+		/// is given: one for `float`, whose hardware estimate is already ~12 bits, and four for
+		/// `double`, whose estimate is ~5 bits
+		template<FloatingPoint T>
+		static constexpr size_t RSQRT_DEFAULT_ITERATIONS = std::is_same_v<T, float> ? 1U : 4U;
+
+		/// @brief Fast approximation calculation of the reciprocal square root, 1 / sqrt(x)
+		///
+		/// Starts from an estimate and refines it with `Iterations` Newton steps, each of which
+		/// roughly doubles the number of correct bits. For `float`, the estimate is the hardware
+		/// `rsqrtss` estimate (~12 bits) when SSE is available; otherwise, and for `double` or
+		/// during constant evaluation, it comes from the bit-manipulation estimate (~5 bits).
+		/// One step is enough for `float` precision with the hardware estimate,
+		/// while `double` precision needs four
+		///
+		/// @tparam Iterations - The number of Newton steps to refine the estimate with
+		/// @param x - The value to take the reciprocal square root of. Must be > 0
+		/// @return - The reciprocal square root of x
+		template<size_t Iterations>
+		[[nodiscard]] inline static constexpr auto
+		rsqrt(FloatingPoint auto x) noexcept -> decltype(x) {
+			if constexpr(std::is_same_v<decltype(x), float>) {
+				return rsqrtf_internal<Iterations>(x);
+			}
+			else {
+				return rsqrt_internal<Iterations>(x);
+			}
+		}
+
+		/// @brief Fast approximation calculation of the reciprocal square root, 1 / sqrt(x),
+		/// refined with `RSQRT_DEFAULT_ITERATIONS` Newton steps for the type of `x`
+		///
+		/// @param x - The value to take the reciprocal square root of. Must be > 0
+		/// @return - The reciprocal square root of x
+		[[nodiscard]] inline static constexpr auto
+		rsqrt(FloatingPoint auto x) noexcept -> decltype(x) {
+			return rsqrt<RSQRT_DEFAULT_ITERATIONS<decltype(x)>>(x);
+		}
+
+		/// @brief Fast approximation calculation of the reciprocal square root of each of the
+		/// given values. Uses `rsqrtps` on four values at a time when SSE is available
+		///
+		/// Processes `min(inputs.size(), out.size())` elements
+		///
+		/// @tparam Iterations - The number of Newton steps to refine the estimates with
+		/// @param inputs - The values to take the reciprocal square root of. Must be > 0
+		/// @param out - The span to store the results in
+		template<size_t Iterations = RSQRT_DEFAULT_ITERATIONS<float>>
+		inline static constexpr auto
+		rsqrt(std::span<const float> inputs, std::span<float> out) noexcept -> void {
+			const auto size = min(inputs.size(), out.size());
+			size_t i = 0;
+#if HYPERION_MATH_HAS_SSE
+			if(!std::is_constant_evaluated()) {
+				const auto vectorizedSize = size - size % 4;
+				const auto half = _mm_set1_ps(0.5F);
+				const auto threeHalves = _mm_set1_ps(1.5F);
+				for(; i < vectorizedSize; i += 4) {
+					const auto x = _mm_loadu_ps(&inputs[i]);
+					const auto xHalf = _mm_mul_ps(x, half);
+					auto estimate = _mm_rsqrt_ps(x);
+					for(size_t iteration = 0; iteration < Iterations; ++iteration) {
+						const auto square = _mm_mul_ps(estimate, estimate);
+						estimate = _mm_mul_ps(estimate,
+											  _mm_sub_ps(threeHalves, _mm_mul_ps(xHalf, square)));
+					}
+					_mm_storeu_ps(&out[i], estimate);
+				}
+			}
+#endif
+			for(; i < size; ++i) {
+				out[i] = rsqrtf_internal<Iterations>(inputs[i]);
+			}
+		}
+
+		/// @brief Fast approximation calculation of the reciprocal square root of each of the
+		/// given values
+		///
+		/// Processes `min(inputs.size(), out.size())` elements
+		///
+		/// @tparam Iterations - The number of Newton steps to refine the estimates with
+		/// @param inputs - The values to take the reciprocal square root of. Must be > 0
+		/// @param out - The span to store the results in
+		template<size_t Iterations = RSQRT_DEFAULT_ITERATIONS<double>>
+		inline static constexpr auto
+		rsqrt(std::span<const double> inputs, std::span<double> out) noexcept -> void {
+			const auto size = min(inputs.size(), out.size());
+			for(size_t i = 0; i < size; ++i) {
+				out[i] = rsqrt_internal<Iterations>(inputs[i]);
+			}
+		}
+
 		/// @brief Calculates the truncation of x
 		///
 		/// @param x - The value to truncate
@@ -113,48 +256,188 @@ namespace hyperion::math {
 			}
 		}
 
+		/// @brief Returns whether `left` and `right` have exactly the same representation.
+		/// Unlike `==`, this doesn't rely on floating point equality, and it tells `0` and `-0`
+		/// apart
+		///
+		/// @param left - The first value
+		/// @param right - The second value
+		/// @return - Whether the two are bitwise equal
+		[[nodiscard]] inline static constexpr auto
+		bit_equal(FloatingPoint auto left, decltype(left) right) noexcept -> bool {
+			using Bits = UIntOfSize<decltype(left)>;
+			return std::bit_cast<Bits>(left) == std::bit_cast<Bits>(right);
+		}
+
+		/// @brief Multiplies every element of `buffer`, in place, by `factor`. If `factor` is
+		/// exactly `1`, `buffer` is left untouched
+		///
+		/// @param buffer - The values to scale
+		/// @param factor - The value to multiply by
+		template<FloatingPoint T>
+		inline static constexpr auto scale(std::span<T> buffer, T factor) noexcept -> void {
+			if(bit_equal(factor, static_cast<T>(1))) {
+				return;
+			}
+			for(auto& element : buffer) {
+				element *= factor;
+			}
+		}
+
 	  private:
-		/// @brief Fast approximation calculation of the square root of the given value
+		/// @brief Calculates the square root of the given value
 		///
 		/// @param x - The value to take the square root of
 		/// @return - The square root of x
 		[[nodiscard]] static constexpr inline auto sqrtf_internal(float x) noexcept -> float {
-			const float xhalf = 0.5F * x;
-			union // get bits for floating value
-			{
-				float f = 0.0F;
-				int i;
-			} u;
-			u.f = x;			// NOLINT
-								// gives initial guess y0. use 0x5fe6ec85e7de30da for double
-			u.i = 0x5F375A86	// NOLINT
-				  - (u.i >> 1); // NOLINT
-			// Newton method, repeating increases accuracy
-			u.f = u.f * (1.5F - xhalf * u.f * u.f); // NOLINT
-			// Newton method, repeating increases accuracy
-			u.f = u.f * (1.5F - xhalf * u.f * u.f); // NOLINT
-			return x * u.f;							// NOLINT
-		}
-
-		/// @brief Fast approximation calculation of the square root of the given value
+			if(std::is_constant_evaluated()) {
+				// the double calculation rounds correctly to float
+				return x > 0.0F ? static_cast<float>(sqrt_iterative(static_cast<double>(x)))
+								: sqrt_special_casesf(x);
+			}
+			else {
+				return std::sqrt(x);
+			}
+		}
+
+		/// @brief Calculates the square root of the given value
 		///
 		/// @param x - The value to take the square root of
 		/// @return - The square root of x
 		[[nodiscard]] static constexpr inline auto sqrt_internal(double x) noexcept -> double {
-			const double xhalf = 0.5 * x;
-			union // get bits for floating value
-			{
-				double f = 0.0;
-				int64_t i;
-			} u;
-			u.f = x; // NOLINT
-			// gives initial guess y0. use 0x5F375A86 for float
-			u.i = 0x5fe6ec85e7de30da - (u.i >> 1); // NOLINT
-			// Newton method, repeating increases accuracy
-			u.f = u.f * (1.5 - xhalf * u.f * u.f); // NOLINT
-			// Newton method, repeating increases accuracy
-			u.f = u.f * (1.5 - xhalf * u.f * u.f); // NOLINT
-			return x * u.f;						   // NOLINT
+			if(std::is_constant_evaluated()) {
+				return x > 0.0 ? sqrt_iterative(x) : sqrt_special_cases(x);
+			}
+			else {
+				return std::sqrt(x);
+			}
+		}
+
+		/// @brief Handles the square root of values that aren't positive; Don't use on its own
+		///
+		/// @param x - The value to take the square root of. Must not be > 0
+		/// @return - The square root of x
+		[[nodiscard]] static constexpr inline auto sqrt_special_casesf(float x) noexcept -> float {
+			// sqrt(+-0) = +-0, sqrt(x < 0) = NaN, sqrt(NaN) = NaN
+			return x < 0.0F ? std::numeric_limits<float>::quiet_NaN() : x;
+		}
+
+		/// @brief Handles the square root of values that aren't positive; Don't use on its own
+		///
+		/// @param x - The value to take the square root of. Must not be > 0
+		/// @return - The square root of x
+		[[nodiscard]] static constexpr inline auto sqrt_special_cases(double x) noexcept -> double {
+			// sqrt(+-0) = +-0, sqrt(x < 0) = NaN, sqrt(NaN) = NaN
+			return x < 0.0 ? std::numeric_limits<double>::quiet_NaN() : x;
+		}
+
+		/// @brief Fast approximation calculation of the reciprocal square root of the given value
+		///
+		/// @tparam Iterations - The number of Newton steps to refine the estimate with
+		/// @param x - The value to take the reciprocal square root of
+		/// @return - The reciprocal square root of x
+		template<size_t Iterations>
+		[[nodiscard]] static constexpr inline auto rsqrtf_internal(float x) noexcept -> float {
+			auto estimate = rsqrtf_estimate(x);
+			const auto xHalf = 0.5F * x;
+			for(size_t i = 0; i < Iterations; ++i) {
+				estimate = estimate * (1.5F - xHalf * estimate * estimate);
+			}
+			return estimate;
+		}
+
+		/// @brief Fast approximation calculation of the reciprocal square root of the given value
+		///
+		/// @tparam Iterations - The number of Newton steps to refine the estimate with
+		/// @param x - The value to take the reciprocal square root of
+		/// @return - The reciprocal square root of x
+		template<size_t Iterations>
+		[[nodiscard]] static constexpr inline auto rsqrt_internal(double x) noexcept -> double {
+			// gives an initial estimate accurate to ~5 bits
+			auto estimate
+				= std::bit_cast<double>(0x5fe6eb50c7b537a9ULL - (std::bit_cast<uint64_t>(x) >> 1U));
+			const auto xHalf = 0.5 * x;
+			for(size_t i = 0; i < Iterations; ++i) {
+				estimate = estimate * (1.5 - xHalf * estimate * estimate);
+			}
+			return estimate;
+		}
+
+		/// @brief Calculates the initial estimate for `rsqrtf_internal`; Don't use on its own
+		///
+		/// @param x - The value to estimate the reciprocal square root of
+		/// @return - The estimate of the reciprocal square root of x
+		[[nodiscard]] static constexpr inline auto rsqrtf_estimate(float x) noexcept -> float {
+#if HYPERION_MATH_HAS_SSE
+			if(!std::is_constant_evaluated()) {
+				return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+			}
+#endif
+			// gives an initial estimate accurate to ~5 bits
+			return std::bit_cast<float>(0x5f375a86U - (std::bit_cast<uint32_t>(x) >> 1U));
+		}
+
+		/// @brief Calculates the square root of the given value with Newton's method.
+		/// Valid in constant evaluation, but much slower than the hardware square root
+		///
+		/// @param x - The value to take the square root of. Must be > 0
+		/// @return - The square root of x
+		[[nodiscard]] static constexpr inline auto sqrt_iterative(double x) noexcept -> double {
+			if(x == std::numeric_limits<double>::infinity()) {
+				return x;
+			}
+			// scale tiny (and subnormal) x up, so the correction below doesn't lose precision
+			// to underflow
+			if(x < 0x1p-900) {
+				return sqrt_iterative(x * 0x1p1000) * 0x1p-500;
+			}
+
+			// halving the exponent gives an initial guess within a factor of sqrt(2) for normal x
+			auto guess
+				= std::bit_cast<double>((std::bit_cast<uint64_t>(x) >> 1U) + 0x1ff8000000000000ULL);
+			// after the first step, every guess is >= sqrt(x) and they decrease monotonically,
+			// so we're done once they stop decreasing
+			guess = 0.5 * (guess + x / guess);
+			for(auto i = 0; i < 128; ++i) {
+				const auto next = 0.5 * (guess + x / guess);
+				if(next >= guess) {
+					break;
+				}
+				guess = next;
+			}
+
+			// Newton's method can settle one ulp away from the correctly rounded result,
+			// so pick whichever neighbor squares closest to x
+			const auto below = std::bit_cast<double>(std::bit_cast<uint64_t>(guess) - 1U);
+			const auto above = std::bit_cast<double>(std::bit_cast<uint64_t>(guess) + 1U);
+			auto result = guess;
+			auto error = abs(square_error(guess, x));
+			if(const auto belowError = abs(square_error(below, x)); belowError < error) {
+				result = below;
+				error = belowError;
+			}
+			if(abs(square_error(above, x)) < error) {
+				result = above;
+			}
+			return result;
+		}
+
+		/// @brief Calculates `root * root - x` without rounding the square, by splitting
+		/// `root` into halves that can be multiplied exactly (Dekker's algorithm)
+		///
+		/// @param root - The candidate square root
+		/// @param x - The value `root` is the candidate square root of
+		/// @return - The error of `root * root` relative to `x`
+		[[nodiscard]] static constexpr inline auto
+		square_error(double root, double x) noexcept -> double {
+			constexpr auto splitter = 134217729.0; // 2^27 + 1
+
+			const auto scaled = root * splitter;
+			const auto high = scaled - (scaled - root);
+			const auto low = root - high;
+			const auto square = root * root;
+			const auto roundingError = ((high * high - square) + 2.0 * high * low) + low * low;
+			return (square - x) + roundingError;
 		}
 	};
 } // namespace hyperion::math
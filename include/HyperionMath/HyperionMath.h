@@ -1,10 +1,15 @@
 #pragma once
+#include "Automation.h"
+#include "ConcurrentInterpolator.h"
 #include "Constants.h"
+#include "Envelope.h"
 #include "Exponentials.h"
 #include "General.h"
 #include "Interpolator.h"
+#include "InterpolatorBank.h"
 #include "Point2.h"
 #include "Point3.h"
+#include "RampTable.h"
 #include "Random.h"
 #include "Trig.h"
 #include "Vec2.h"
@@ -1,12 +1,21 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <gsl/gsl>
+#include <limits>
+#include <span>
 #include <type_traits>
+#include <variant>
 
+#include "Constants.h"
 #include "Exponentials.h"
+#include "General.h"
 #include "HyperionUtils/Concepts.h"
 #include "HyperionUtils/Macros.h"
 #include "HyperionUtils/OptionAndResult.h"
+#include "Trig.h"
 
 namespace hyperion::math {
 	using utils::None;
@@ -18,7 +27,16 @@ namespace hyperion::math {
 	{
 		Linear = 0,
 		Logarithmic,
-		Exponential
+		Exponential,
+		/// A raised-cosine S-curve, `(1 - cos(pi * t)) / 2`
+		Cosine,
+		/// A quarter sine wave: rises as `sin(pi / 2 * t)` and falls as `cos(pi / 2 * t)`, so a
+		/// rising and a falling transition together keep constant power
+		EqualPower,
+		/// A cubic Hermite curve, with start and end slopes set by `Interpolator::set_tangents`
+		CubicHermite,
+		/// The cubic S-curve `3t^2 - 2t^3`: a cubic Hermite curve that starts and ends flat
+		Smoothstep
 	};
 
 	IGNORE_PADDING_START
@@ -108,18 +126,207 @@ namespace hyperion::math {
 		///
 		/// @return - The interpolation value
 		inline auto get_next_value(Option<size_t> currentSample = None()) noexcept -> T {
+			auto resync = false;
 			if(currentSample.is_some()) {
 				m_current_transition_sample = currentSample.unwrap();
+				resync = true;
 			}
 
 			if(m_current_transition_sample <= m_samples_to_transition) {
-				m_current_value = interpolate(m_current_transition_sample);
+				if constexpr(Type == InterpolationType::Linear || IS_POLYNOMIAL) {
+					m_current_value = interpolate(m_current_transition_sample);
+				}
+				else {
+					m_current_value = resync || !m_incremental
+										  ? interpolate(m_current_transition_sample)
+										  : next_incremental_value(m_current_transition_sample,
+																   m_current_value);
+				}
 				m_current_transition_sample++;
 			}
 
 			return m_current_value;
 		}
 
+		/// @brief Returns the most recently generated value, without advancing the sequence
+		///
+		/// @return - The current interpolation value
+		[[nodiscard]] constexpr inline auto get_current_value() const noexcept -> T {
+			return m_current_value;
+		}
+
+		/// @brief Gets the value in the interpolation sequence for the given sample, without
+		/// advancing the sequence. Samples past the end of the transition give the final value
+		///
+		/// @param sample - The sample in the sequence to get the value for
+		///
+		/// @return - The interpolation value
+		[[nodiscard]] constexpr inline auto value_at(size_t sample) const noexcept -> T {
+			return interpolate(std::min<size_t>(sample, m_samples_to_transition));
+		}
+
+		/// @brief Returns whether the transition has finished, so every subsequent value will be
+		/// the same final value until the target or transition is changed
+		///
+		/// @return - Whether this has settled
+		[[nodiscard]] constexpr inline auto is_settled() const noexcept -> bool {
+			return m_current_transition_sample > m_samples_to_transition;
+		}
+
+		/// @brief Returns the number of values left in the transition, after which the value
+		/// stays constant
+		///
+		/// @return - The number of remaining transition values, `0` if this has settled
+		[[nodiscard]] constexpr inline auto samples_remaining() const noexcept -> size_t {
+			if(is_settled()) {
+				return 0ULL;
+			}
+			return m_samples_to_transition - m_current_transition_sample + 1ULL;
+		}
+
+		/// @brief Sets whether logarithmic, exponential, cosine and equal-power interpolation
+		/// advance incrementally. In incremental mode, each value is calculated from the previous
+		/// one with a single multiply-add (or, for the cosine and equal-power shapes, a rotation
+		/// of the sine and cosine of the previous phase), and the closed-form curve is evaluated
+		/// only every `INCREMENTAL_RESYNC_INTERVAL` samples to bound the accumulated rounding
+		/// error. Linear and polynomial interpolation are always cheap, so are unaffected, and
+		/// `process` and `apply` always generate cosine and equal-power ramps in closed form,
+		/// because evaluating them a block at a time vectorizes
+		///
+		/// @param incremental - Whether to interpolate incrementally
+		constexpr inline auto set_incremental(bool incremental) noexcept -> void {
+			m_incremental = incremental;
+			update_coefficients();
+		}
+
+		/// @brief Returns whether logarithmic, exponential, cosine and equal-power interpolation
+		/// advance incrementally
+		///
+		/// @return - Whether this is in incremental mode
+		[[nodiscard]] constexpr inline auto is_incremental() const noexcept -> bool {
+			return m_incremental;
+		}
+
+		/// @brief Sets the slopes of the curve at the start and end of the transition, relative
+		/// to the slope of a linear ramp between the same values: `1` matches the linear ramp and
+		/// `0` starts or ends flat. Both default to `0`
+		/// @note This is only available for `Interpolator`s of type
+		/// `InterpolationType::CubicHermite`
+		///
+		/// @param startTangent - The relative slope at the start of the transition
+		/// @param endTangent - The relative slope at the end of the transition
+		constexpr inline auto set_tangents(T startTangent, T endTangent) noexcept
+			-> void requires(Type == InterpolationType::CubicHermite) {
+			m_curve.start_tangent = startTangent;
+			m_curve.end_tangent = endTangent;
+			update_coefficients();
+		}
+
+		/// @brief Fills `out` with the next `out.size()` values in the interpolation sequence.
+		/// Equivalent to calling `get_next_value()` once per element, but linear and polynomial
+		/// ramps are generated in a single vectorizable loop, and once the transition has finished
+		/// the rest of the block is filled with the final value
+		///
+		/// @param out - The buffer to fill with interpolation values
+		///
+		/// @return - Whether this had already settled, so every value in `out` is the same (and
+		/// equal to `get_current_value()`)
+		inline auto process(std::span<T> out) noexcept -> bool {
+			const auto rampLength = next_ramp_length(out.size());
+			generate_ramp(out.first(rampLength), [](T& element, T value) { element = value; });
+			std::fill(out.begin() + gsl::narrow_cast<std::ptrdiff_t>(rampLength),
+					  out.end(),
+					  m_current_value);
+			return rampLength == 0ULL;
+		}
+
+		/// @brief Multiplies `buffer`, in place, by the next `buffer.size()` values in the
+		/// interpolation sequence. Once the transition has finished, the rest of the block is
+		/// multiplied by the final value, unless that is exactly `1`, in which case it is left
+		/// untouched
+		///
+		/// @param buffer - The buffer to apply the interpolation values to
+		///
+		/// @return - Whether this had already settled, so all of `buffer` was multiplied by the
+		/// same value (`get_current_value()`)
+		inline auto apply(std::span<T> buffer) noexcept -> bool {
+			const auto rampLength = next_ramp_length(buffer.size());
+			generate_ramp(buffer.first(rampLength), [](T& element, T value) { element *= value; });
+
+			General::scale(buffer.subspan(rampLength), m_current_value);
+			return rampLength == 0ULL;
+		}
+
+		/// @brief Multiplies every channel of a planar buffer, in place, by the next `frames`
+		/// values in the interpolation sequence, where `frames` is the length of the shortest
+		/// channel. The ramp is generated once, a chunk at a time, and each chunk is applied to
+		/// each channel in a vectorizable loop
+		///
+		/// @param channels - The channels to apply the interpolation values to
+		///
+		/// @return - Whether this had already settled, so all of every channel was multiplied by
+		/// the same value (`get_current_value()`)
+		inline auto apply_planar(std::span<const std::span<T>> channels) noexcept -> bool {
+			auto frames = channels.empty() ? 0ULL : channels.front().size();
+			for(const auto channel : channels) {
+				frames = std::min<size_t>(frames, channel.size());
+			}
+
+			return apply_frames(
+				frames,
+				[channels](size_t offset, std::span<const T> ramp) {
+					for(const auto channel : channels) {
+						auto* samples = channel.data() + offset; // NOLINT
+						for(auto i = 0ULL; i < ramp.size(); ++i) {
+							samples[i] *= ramp[i]; // NOLINT
+						}
+					}
+				},
+				[channels, frames](size_t offset, T value) {
+					for(const auto channel : channels) {
+						for(auto i = offset; i < frames; ++i) {
+							channel[i] *= value;
+						}
+					}
+				});
+		}
+
+		/// @brief Multiplies every channel of an interleaved buffer of `Channels` channels, in
+		/// place, by the next `buffer.size() / Channels` values in the interpolation sequence:
+		/// each frame of `Channels` samples is multiplied by the same value. Any trailing
+		/// partial frame is left untouched
+		///
+		/// @tparam Channels - The number of interleaved channels
+		/// @param buffer - The buffer to apply the interpolation values to
+		///
+		/// @return - Whether this had already settled, so all of `buffer` was multiplied by the
+		/// same value (`get_current_value()`)
+		template<size_t Channels>
+		inline auto apply_interleaved(std::span<T> buffer) noexcept -> bool {
+			static_assert(Channels > 0ULL, "An interleaved buffer needs at least one channel");
+			return apply_interleaved_frames<Channels>(buffer, Channels);
+		}
+
+		/// @brief Multiplies every channel of an interleaved buffer of `numChannels` channels,
+		/// in place, by the next `buffer.size() / numChannels` values in the interpolation
+		/// sequence. Mono and stereo buffers use the `apply_interleaved<Channels>` loops
+		/// specialized for their channel count
+		///
+		/// @param buffer - The buffer to apply the interpolation values to
+		/// @param numChannels - The number of interleaved channels
+		///
+		/// @return - Whether this had already settled, so all of `buffer` was multiplied by the
+		/// same value (`get_current_value()`)
+		inline auto apply_interleaved(std::span<T> buffer, size_t numChannels) noexcept -> bool {
+			if(numChannels == 1ULL) {
+				return apply_interleaved<1ULL>(buffer);
+			}
+			if(numChannels == 2ULL) {
+				return apply_interleaved<2ULL>(buffer);
+			}
+			return apply_interleaved_frames<0ULL>(buffer, std::max<size_t>(numChannels, 1ULL));
+		}
+
 		/// @brief Resets the `Interpolator`.
 		/// - If `initial_value` is given, the `Interpolator` will start at the given one instead of
 		/// `DEFAULT_INITIAL_VALUE`
@@ -148,6 +355,7 @@ namespace hyperion::math {
 				  / (gsl::narrow_cast<T>(m_sample_rate) * m_transition_lengthSeconds);
 			m_samples_to_transition = get_samples_to_transition();
 			m_current_transition_sample = 0ULL;
+			update_coefficients();
 		}
 
 		/// @brief Sets the target value to interpolate to, to the given one
@@ -160,28 +368,66 @@ namespace hyperion::math {
 				= (m_target_value - m_initial_value)
 				  / (gsl::narrow_cast<T>(m_sample_rate) * m_transition_lengthSeconds);
 			m_samples_to_transition = get_samples_to_transition();
+			m_current_transition_sample = 0ULL;
+			update_coefficients();
 		}
 
-		/// @brief Sets the sample rate to use for interpolation
+		/// @brief Sets the sample rate to use for interpolation. A transition in progress
+		/// continues from the same point in time at the new rate, instead of restarting
 		///
 		/// @param sampleRate - The sample rate to use for interpolation
 		inline auto set_sample_rate(size_t sampleRate) noexcept -> void {
-			m_sample_rate = sampleRate;
-			mLinearTransitionStep
-				= (m_target_value - m_initial_value)
-				  / (gsl::narrow_cast<T>(m_sample_rate) * m_transition_lengthSeconds);
-			m_samples_to_transition = get_samples_to_transition();
-			m_current_transition_sample = 0ULL;
+			change_rate(sampleRate * m_oversampling_factor);
+		}
+
+		/// @brief Returns the sample rate used for interpolation, excluding any oversampling
+		///
+		/// @return - The sample rate
+		[[nodiscard]] constexpr inline auto get_sample_rate() const noexcept -> size_t {
+			return m_sample_rate / m_oversampling_factor;
+		}
+
+		/// @brief Sets the factor of the sample rate to render at, so the interpolator can be
+		/// run in an oversampled section of the signal chain. At a factor of `N`, each second of
+		/// transition takes `N` times as many values. A transition in progress continues from
+		/// the same point in time
+		///
+		/// @param factor - The oversampling factor, at least `1`
+		inline auto set_oversampling_factor(size_t factor) noexcept -> void {
+			const auto sampleRate = get_sample_rate();
+			m_oversampling_factor = std::max<size_t>(factor, 1ULL);
+			change_rate(sampleRate * m_oversampling_factor);
+		}
+
+		/// @brief Returns the factor of the sample rate to render at
+		///
+		/// @return - The oversampling factor
+		[[nodiscard]] constexpr inline auto get_oversampling_factor() const noexcept -> size_t {
+			return m_oversampling_factor;
 		}
 
 		constexpr auto
 		operator=(const Interpolator& interpolator) noexcept -> Interpolator& = default;
 		constexpr auto operator=(Interpolator&& interpolator) noexcept -> Interpolator& = default;
 
-	  private:
+		/// The number of ramp values multichannel processing generates at a time
+		static constexpr size_t MULTICHANNEL_CHUNK_SIZE = 256ULL;
+		/// The number of samples between evaluations of the closed-form curve in incremental mode
+		static constexpr size_t INCREMENTAL_RESYNC_INTERVAL = 64ULL;
+		/// The number of time constants the logarithmic and exponential curves span over the
+		/// transition length
 		static constexpr T LOG_TIME_FACTOR = gsl::narrow_cast<T>(5.0);
 		static constexpr T EXP_TIME_FACTOR = gsl::narrow_cast<T>(0.693);
 
+	  private:
+		/// Whether `Type` is a cubic polynomial in the sample index
+		static constexpr bool IS_POLYNOMIAL
+			= Type == InterpolationType::CubicHermite || Type == InterpolationType::Smoothstep;
+		/// Whether `Type` is a function of the sine and cosine of a phase that rises linearly
+		/// from `0` to `pi / 2` over the transition
+		static constexpr bool IS_SINUSOIDAL
+			= Type == InterpolationType::Cosine || Type == InterpolationType::EqualPower;
+
 		size_t m_sample_rate = DEFAULT_SAMPLE_RATE;
 		T m_target_value = DEFAULT_TARGET_VALUE;
 		T m_current_value = DEFAULT_INITIAL_VALUE;
@@ -190,30 +436,320 @@ namespace hyperion::math {
 		T mLinearTransitionStep
 			= (m_target_value - m_initial_value)
 			  / (gsl::narrow_cast<T>(m_sample_rate) * m_transition_lengthSeconds);
+		bool m_incremental = false;
 		size_t m_samples_to_transition = get_samples_to_transition();
 		size_t m_current_transition_sample = 0;
+		size_t m_oversampling_factor = 1ULL;
+
+		/// The state of linear interpolation, which needs none beyond the common members
+		struct LinearState {};
+
+		/// The state of the recurrence logarithmic and exponential interpolation advance by in
+		/// incremental mode, `y[n] = multiplier * y[n - 1] + offset`
+		struct RecurrenceState {
+			T multiplier = gsl::narrow_cast<T>(1.0);
+			T offset = gsl::narrow_cast<T>(0.0);
+		};
+
+		/// The state of polynomial interpolation
+		struct PolynomialState {
+			T start_tangent = gsl::narrow_cast<T>(0.0);
+			T end_tangent = gsl::narrow_cast<T>(0.0);
+			/// The coefficients of the first, second and third powers of the sample index
+			std::array<T, 3> coefficients = {};
+		};
+
+		/// The state of sinusoidal interpolation
+		struct SinusoidalState {
+			/// The phase step per sample
+			T phase_step = gsl::narrow_cast<T>(0.0);
+			/// The sine and cosine of `phase_step`
+			SinCos<T> rotation = {gsl::narrow_cast<T>(0.0), gsl::narrow_cast<T>(1.0)};
+			/// The sine and cosine of the phase of `phasor_sample`, in incremental mode
+			SinCos<T> phasor = {gsl::narrow_cast<T>(0.0), gsl::narrow_cast<T>(1.0)};
+			size_t phasor_sample = std::numeric_limits<size_t>::max();
+		};
+
+		/// The state specific to the shape of `Type`, so each `Interpolator` only carries what
+		/// its own curve uses
+		using CurveState = std::conditional_t<
+			IS_POLYNOMIAL,
+			PolynomialState,
+			std::conditional_t<IS_SINUSOIDAL,
+							   SinusoidalState,
+							   std::conditional_t<Type == InterpolationType::Linear,
+												  LinearState,
+												  RecurrenceState>>>;
+
+		[[no_unique_address]] CurveState m_curve = make_curve_state();
+
+		/// @brief Changes the rate values are generated at, moving the position in the
+		/// transition to the sample at the same point in time at the new rate
+		///
+		/// @param sampleRate - The new rate, including any oversampling
+		inline auto change_rate(size_t sampleRate) noexcept -> void {
+			const auto settled = is_settled();
+			const auto previousRate = m_sample_rate;
+			m_sample_rate = sampleRate;
+			mLinearTransitionStep
+				= (m_target_value - m_initial_value)
+				  / (gsl::narrow_cast<T>(m_sample_rate) * m_transition_lengthSeconds);
+			m_samples_to_transition = get_samples_to_transition();
+			if(settled) {
+				m_current_transition_sample = m_samples_to_transition + 1ULL;
+			}
+			else if(previousRate != 0ULL) {
+				// round to the nearest sample at the new rate
+				const auto rescaled
+					= (m_current_transition_sample * m_sample_rate + previousRate / 2ULL)
+					  / previousRate;
+				m_current_transition_sample = std::min<size_t>(rescaled, m_samples_to_transition);
+			}
+			update_coefficients();
+		}
 
 		/// @brief Gets the interpolated value for the given sample
 		///
 		/// @param sample - The sample to get the interpolated value for
 		///
 		/// @return The interpolated value
-		inline auto interpolate(size_t sample) noexcept -> T {
+		constexpr inline auto interpolate(size_t sample) const noexcept -> T {
 			if constexpr(Type == InterpolationType::Linear) {
 				return linear_interpolation(sample);
 			}
 			else if constexpr(Type == InterpolationType::Logarithmic) {
 				return log_interpolation(sample);
 			}
-			else {
+			else if constexpr(Type == InterpolationType::Exponential) {
 				return exp_interpolation(sample);
 			}
+			else if constexpr(IS_POLYNOMIAL) {
+				return polynomial_interpolation(sample);
+			}
+			else {
+				return sinusoidal_interpolation(
+					Trig::sincos(gsl::narrow_cast<T>(sample) * m_curve.phase_step));
+			}
 		}
 
-		inline auto linear_interpolation(size_t sample) noexcept -> T {
+		constexpr inline auto linear_interpolation(size_t sample) const noexcept -> T {
 			return m_initial_value + (mLinearTransitionStep * gsl::narrow_cast<T>(sample));
 		}
 
+		/// @brief Gets the interpolated value for the given sample in incremental mode, from the
+		/// value for the previous sample
+		///
+		/// @param sample - The sample to get the interpolated value for
+		/// @param previous - The interpolated value for `sample - 1`
+		///
+		/// @return - The interpolated value
+		inline auto
+		next_incremental_value(size_t sample, [[maybe_unused]] T previous) noexcept -> T {
+			if constexpr(IS_SINUSOIDAL) {
+				// the phasor may be stale if the sequence was moved with `get_next_value`
+				auto& curve = m_curve;
+				if(sample % INCREMENTAL_RESYNC_INTERVAL == 0ULL
+				   || sample != curve.phasor_sample + 1ULL) {
+					curve.phasor = Trig::sincos(gsl::narrow_cast<T>(sample) * curve.phase_step);
+				}
+				else {
+					const auto phasor = curve.phasor;
+					curve.phasor.sin
+						= phasor.sin * curve.rotation.cos + phasor.cos * curve.rotation.sin;
+					curve.phasor.cos
+						= phasor.cos * curve.rotation.cos - phasor.sin * curve.rotation.sin;
+				}
+				curve.phasor_sample = sample;
+				return sinusoidal_interpolation(curve.phasor);
+			}
+			else {
+				if(sample % INCREMENTAL_RESYNC_INTERVAL == 0ULL) {
+					return interpolate(sample);
+				}
+				return previous * m_curve.multiplier + m_curve.offset;
+			}
+		}
+
+		/// @brief Updates the coefficients of the curve and of the recurrence used in incremental
+		/// mode.
+		///
+		/// The logarithmic and exponential curves are an offset exponential,
+		/// `y[n] = a * k^n + b`, so consecutive samples are related by
+		/// `y[n] = k * y[n - 1] + b * (1 - k)`:
+		/// - logarithmic: `k = e^{-1 / tau}`, `b = target`
+		/// - exponential: `k = e^{1 / tau}`, `b = 2 * initial - target`
+		///
+		/// where tau = sampleRate * transitionLength / time_factor
+		///
+		/// The sinusoidal curves instead advance their phase by rotating its sine and cosine by
+		/// those of the phase step
+		constexpr inline auto update_coefficients() noexcept -> void {
+			if constexpr(Type == InterpolationType::Logarithmic) {
+				const auto tau = gsl::narrow_cast<T>(m_sample_rate) * m_transition_lengthSeconds
+								 / LOG_TIME_FACTOR;
+				m_curve.multiplier = math::Exponentials::exp(gsl::narrow_cast<T>(-1.0) / tau);
+				m_curve.offset = m_target_value * (gsl::narrow_cast<T>(1.0) - m_curve.multiplier);
+			}
+			else if constexpr(Type == InterpolationType::Exponential) {
+				const auto tau = gsl::narrow_cast<T>(m_sample_rate) * m_transition_lengthSeconds
+								 / EXP_TIME_FACTOR;
+				m_curve.multiplier = math::Exponentials::exp(gsl::narrow_cast<T>(1.0) / tau);
+				m_curve.offset = (gsl::narrow_cast<T>(2.0) * m_initial_value - m_target_value)
+								 * (gsl::narrow_cast<T>(1.0) - m_curve.multiplier);
+			}
+			else if constexpr(IS_POLYNOMIAL) {
+				m_curve.coefficients
+					= get_cubic_coefficients(m_curve.start_tangent, m_curve.end_tangent);
+			}
+			else if constexpr(IS_SINUSOIDAL) {
+				m_curve.phase_step = get_phase_step();
+				m_curve.rotation = Trig::sincos(m_curve.phase_step);
+				m_curve.phasor_sample = std::numeric_limits<size_t>::max();
+			}
+		}
+
+		/// @brief Gets the number of values of the next `blockSize` that are still part of the
+		/// transition
+		///
+		/// @param blockSize - The number of values requested
+		///
+		/// @return - The number of values left in the transition, at most `blockSize`
+		[[nodiscard]] inline auto next_ramp_length(size_t blockSize) const noexcept -> size_t {
+			return std::min<size_t>(blockSize, samples_remaining());
+		}
+
+		/// @brief Applies the next `frames` values in the interpolation sequence to a buffer of
+		/// `frames` frames. The transition values are generated into a scratch buffer, a chunk at
+		/// a time, and passed to `applyRamp`; the rest of the frames are passed to
+		/// `applyConstant` with the final value, unless that is exactly `1`
+		///
+		/// @param frames - The number of frames to apply values to
+		/// @param applyRamp - Applies a chunk of the transition,
+		/// `void(size_t offset, std::span<const T> ramp)`
+		/// @param applyConstant - Applies the final value to the frames from `offset` on,
+		/// `void(size_t offset, T value)`
+		///
+		/// @return - Whether this had already settled
+		template<typename ApplyRamp, typename ApplyConstant>
+		inline auto apply_frames(size_t frames,
+								 ApplyRamp applyRamp,
+								 ApplyConstant applyConstant) noexcept -> bool {
+			const auto rampLength = next_ramp_length(frames);
+			auto ramp = std::array<T, MULTICHANNEL_CHUNK_SIZE>();
+			for(auto offset = 0ULL; offset < rampLength; offset += ramp.size()) {
+				const auto chunk
+					= std::span<T>(ramp).first(std::min<size_t>(ramp.size(), rampLength - offset));
+				generate_ramp(chunk, [](T& element, T value) { element = value; });
+				applyRamp(offset, std::span<const T>(chunk));
+			}
+
+			const auto value = m_current_value;
+			if(rampLength < frames && !General::bit_equal(value, gsl::narrow_cast<T>(1.0))) {
+				applyConstant(rampLength, value);
+			}
+			return rampLength == 0ULL;
+		}
+
+		/// @brief Applies the next `buffer.size() / numChannels` values in the interpolation
+		/// sequence to an interleaved buffer. See `apply_interleaved`
+		///
+		/// @tparam Channels - The number of interleaved channels, if known at compile time, so
+		/// the loops can be specialized for it, otherwise `0`
+		/// @param buffer - The buffer to apply the interpolation values to
+		/// @param channelCount - The number of interleaved channels
+		///
+		/// @return - Whether this had already settled
+		template<size_t Channels>
+		inline auto
+		apply_interleaved_frames(std::span<T> buffer, size_t channelCount) noexcept -> bool {
+			const auto numChannels = Channels == 0ULL ? channelCount : Channels;
+			const auto frames = buffer.size() / numChannels;
+			return apply_frames(
+				frames,
+				[buffer, numChannels](size_t offset, std::span<const T> ramp) {
+					auto* samples = buffer.data() + offset * numChannels; // NOLINT
+					for(auto i = 0ULL; i < ramp.size(); ++i) {
+						for(auto channel = 0ULL; channel < numChannels; ++channel) {
+							samples[i * numChannels + channel] *= ramp[i]; // NOLINT
+						}
+					}
+				},
+				[buffer, frames, numChannels](size_t offset, T value) {
+					for(auto i = offset * numChannels; i < frames * numChannels; ++i) {
+						buffer[i] *= value;
+					}
+				});
+		}
+
+		/// @brief Generates the next `buffer.size()` transition values, passing each to
+		/// `store` along with the corresponding element of `buffer`. `buffer` must not extend
+		/// past the end of the transition
+		///
+		/// @param buffer - The buffer the interpolation values are stored in
+		/// @param store - How to store a value, `void(T& element, T value)`
+		template<typename Store>
+		inline auto generate_ramp(std::span<T> buffer, Store store) noexcept -> void {
+			if(buffer.empty()) {
+				return;
+			}
+
+			const auto start = m_current_transition_sample;
+			const auto end = start + buffer.size();
+			if constexpr(Type == InterpolationType::Linear || IS_POLYNOMIAL) {
+				// 32-bit sample indices convert to floating point in SIMD registers, 64-bit ones
+				// generally don't
+				if(end <= gsl::narrow_cast<size_t>(std::numeric_limits<std::int32_t>::max())) {
+					// copy the members so the compiler knows `buffer` can't alias them
+					const auto initial = m_initial_value;
+					const auto step = mLinearTransitionStep;
+					const auto curve = m_curve;
+					const auto first = gsl::narrow_cast<std::int32_t>(start);
+					for(auto i = 0ULL; i < buffer.size(); ++i) {
+						const auto index = gsl::narrow_cast<T>(first
+															   + gsl::narrow_cast<std::int32_t>(i));
+						if constexpr(Type == InterpolationType::Linear) {
+							store(buffer[i], initial + step * index);
+						}
+						else {
+							store(buffer[i],
+								  initial
+									  + index
+											* (curve.coefficients[0]
+											   + index
+													 * (curve.coefficients[1]
+														+ index * curve.coefficients[2])));
+						}
+					}
+				}
+				else {
+					for(auto i = 0ULL; i < buffer.size(); ++i) {
+						store(buffer[i], interpolate(start + i));
+					}
+				}
+			}
+			else {
+				// the closed-form sinusoidal curves vectorize, which is cheaper than rotating the
+				// phasor one sample at a time
+				if(m_incremental && !IS_SINUSOIDAL) {
+					auto value = m_current_value;
+					for(auto i = 0ULL; i < buffer.size(); ++i) {
+						value = next_incremental_value(start + i, value);
+						store(buffer[i], value);
+					}
+					m_current_value = value;
+					m_current_transition_sample = end;
+					return;
+				}
+
+				for(auto i = 0ULL; i < buffer.size(); ++i) {
+					store(buffer[i], interpolate(start + i));
+				}
+			}
+
+			m_current_value = interpolate(end - 1ULL);
+			m_current_transition_sample = end;
+		}
+
 		/// @brief Performs "logarithmic" interpolation.
 		/// In reality, this is a pseudo logarithmic shape:
 		///
@@ -227,7 +763,7 @@ namespace hyperion::math {
 		/// @param sample - The sample to get the interpolation value for
 		///
 		/// @return - The interpolated value
-		inline auto log_interpolation(size_t sample) noexcept -> T {
+		constexpr inline auto log_interpolation(size_t sample) const noexcept -> T {
 			return (m_initial_value - m_target_value)
 					   * math::Exponentials::exp(-gsl::narrow_cast<T>(sample)
 												 / (gsl::narrow_cast<T>(m_sample_rate)
@@ -244,7 +780,7 @@ namespace hyperion::math {
 		/// @param sample The sample to get the interpolation value for
 		///
 		/// @return - The interpolated value
-		inline auto exp_interpolation(size_t sample) noexcept -> T {
+		constexpr inline auto exp_interpolation(size_t sample) const noexcept -> T {
 			return (m_target_value - m_initial_value)
 					   * (math::Exponentials::exp(
 							  gsl::narrow_cast<T>(sample)
@@ -254,14 +790,163 @@ namespace hyperion::math {
 				   + m_initial_value;
 		}
 
+		/// @brief Performs cubic polynomial interpolation, as a cubic Hermite curve between the
+		/// initial and target values:
+		///
+		/// y = initial + (target - initial) * h(t)
+		///
+		/// h(t) = (t^3 - 2t^2 + t) * startTangent + (3t^2 - 2t^3) + (t^3 - t^2) * endTangent
+		///
+		/// where t = sample / (sampleRate * transitionLength)
+		///
+		/// @param sample - The sample to get the interpolation value for
+		///
+		/// @return - The interpolated value
+		constexpr inline auto polynomial_interpolation(size_t sample) const noexcept -> T {
+			const auto index = gsl::narrow_cast<T>(sample);
+			return m_initial_value
+				   + index
+						 * (m_curve.coefficients[0]
+							+ index * (m_curve.coefficients[1] + index * m_curve.coefficients[2]));
+		}
+
+		/// @brief Performs sinusoidal interpolation, from the sine and cosine of the phase
+		/// `p = pi / 2 * t`, where t = sample / (sampleRate * transitionLength):
+		/// - cosine: y = initial + (target - initial) * sin^2(p), or (1 - cos(2p)) / 2
+		/// - equal-power, rising: y = initial + (target - initial) * sin(p)
+		/// - equal-power, falling: y = target + (initial - target) * cos(p)
+		///
+		/// @param phasor - The sine and cosine of the phase of the sample
+		///
+		/// @return - The interpolated value
+		constexpr inline auto sinusoidal_interpolation(SinCos<T> phasor) const noexcept -> T {
+			if constexpr(Type == InterpolationType::Cosine) {
+				return m_initial_value
+					   + (m_target_value - m_initial_value) * phasor.sin * phasor.sin;
+			}
+			else {
+				if(m_target_value >= m_initial_value) {
+					return m_initial_value + (m_target_value - m_initial_value) * phasor.sin;
+				}
+				return m_target_value + (m_initial_value - m_target_value) * phasor.cos;
+			}
+		}
+
+		/// @brief Gets the coefficients of the first, second and third powers of the sample index
+		/// in polynomial interpolation. See `polynomial_interpolation`
+		///
+		/// @param startTangent - The relative slope at the start of the transition
+		/// @param endTangent - The relative slope at the end of the transition
+		///
+		/// @return - The coefficients
+		[[nodiscard]] constexpr inline auto
+		get_cubic_coefficients(T startTangent, T endTangent) const noexcept -> std::array<T, 3> {
+			const auto difference = m_target_value - m_initial_value;
+			const auto samples = gsl::narrow_cast<T>(m_sample_rate) * m_transition_lengthSeconds;
+			const auto step = gsl::narrow_cast<T>(1.0) / samples;
+			return {difference * startTangent * step,
+					difference
+						* (gsl::narrow_cast<T>(3.0) - gsl::narrow_cast<T>(2.0) * startTangent
+						   - endTangent)
+						* step * step,
+					difference * (startTangent + endTangent - gsl::narrow_cast<T>(2.0)) * step
+						* step * step};
+		}
+
+		/// @brief Gets the phase step per sample in sinusoidal interpolation
+		///
+		/// @return - The phase step
+		[[nodiscard]] constexpr inline auto get_phase_step() const noexcept -> T {
+			return Constants<T>::piOver2
+				   / (gsl::narrow_cast<T>(m_sample_rate) * m_transition_lengthSeconds);
+		}
+
+		/// @brief Creates the state specific to the shape of `Type` for the current transition,
+		/// with the default tangents
+		///
+		/// @return - The initial curve state
+		[[nodiscard]] constexpr inline auto make_curve_state() const noexcept -> CurveState {
+			auto state = CurveState();
+			if constexpr(IS_POLYNOMIAL) {
+				state.coefficients = get_cubic_coefficients(state.start_tangent, state.end_tangent);
+			}
+			else if constexpr(IS_SINUSOIDAL) {
+				state.phase_step = get_phase_step();
+				state.rotation = Trig::sincos(state.phase_step);
+			}
+			return state;
+		}
+
 		/// @brief Gets the number of samples necessary to fully complete the interpolation sequence
 		///
 		/// @return The number of samples in the interpolation sequence
-		inline auto get_samples_to_transition() noexcept -> size_t {
+		constexpr inline auto get_samples_to_transition() const noexcept -> size_t {
 			return gsl::narrow_cast<size_t>(gsl::narrow_cast<T>(m_sample_rate)
 											* m_transition_lengthSeconds);
 		}
 	};
 	IGNORE_PADDING_STOP
 
+	/// @brief An `Interpolator` of any `InterpolationType`, for when the shape is chosen at
+	/// runtime
+	///
+	/// @tparam T - The floating point type to perform operations in
+	template<FloatingPoint T>
+	using AnyInterpolator = std::variant<Interpolator<T, InterpolationType::Linear>,
+										 Interpolator<T, InterpolationType::Logarithmic>,
+										 Interpolator<T, InterpolationType::Exponential>,
+										 Interpolator<T, InterpolationType::Cosine>,
+										 Interpolator<T, InterpolationType::EqualPower>,
+										 Interpolator<T, InterpolationType::CubicHermite>,
+										 Interpolator<T, InterpolationType::Smoothstep>>;
+
+	/// @brief Creates an `AnyInterpolator` holding an `Interpolator` of the given type, with
+	/// the given target and initial values, time to interpolate over, and sample rate
+	///
+	/// @param type - The type of interpolation
+	/// @param targetValue - The target final value to interpolate to
+	/// @param initialValue - The initial value to start interpolation from
+	/// @param transitionLengthSeconds - The transition time to interpolate over
+	/// @param sampleRate - The sample rate to process at
+	///
+	/// @return - The interpolator
+	template<FloatingPoint T>
+	[[nodiscard]] inline auto make_interpolator(InterpolationType type,
+												T targetValue,
+												T initialValue,
+												T transitionLengthSeconds,
+												size_t sampleRate) noexcept -> AnyInterpolator<T> {
+		auto interpolator = AnyInterpolator<T>();
+		switch(type) {
+			case InterpolationType::Linear:
+				interpolator = Interpolator<T, InterpolationType::Linear>(
+					targetValue, initialValue, transitionLengthSeconds, sampleRate);
+				break;
+			case InterpolationType::Logarithmic:
+				interpolator = Interpolator<T, InterpolationType::Logarithmic>(
+					targetValue, initialValue, transitionLengthSeconds, sampleRate);
+				break;
+			case InterpolationType::Exponential:
+				interpolator = Interpolator<T, InterpolationType::Exponential>(
+					targetValue, initialValue, transitionLengthSeconds, sampleRate);
+				break;
+			case InterpolationType::Cosine:
+				interpolator = Interpolator<T, InterpolationType::Cosine>(
+					targetValue, initialValue, transitionLengthSeconds, sampleRate);
+				break;
+			case InterpolationType::EqualPower:
+				interpolator = Interpolator<T, InterpolationType::EqualPower>(
+					targetValue, initialValue, transitionLengthSeconds, sampleRate);
+				break;
+			case InterpolationType::CubicHermite:
+				interpolator = Interpolator<T, InterpolationType::CubicHermite>(
+					targetValue, initialValue, transitionLengthSeconds, sampleRate);
+				break;
+			case InterpolationType::Smoothstep:
+				interpolator = Interpolator<T, InterpolationType::Smoothstep>(
+					targetValue, initialValue, transitionLengthSeconds, sampleRate);
+				break;
+		}
+		return interpolator;
+	}
 } // namespace hyperion::math
@@ -0,0 +1,312 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <gsl/gsl>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "Exponentials.h"
+#include "General.h"
+#include "HyperionUtils/Concepts.h"
+#include "Interpolator.h"
+
+namespace hyperion::math {
+	using utils::concepts::FloatingPoint;
+
+	/// @brief A bank of independent interpolators, stored in structure-of-arrays form so they
+	/// can all be advanced at once with SIMD.
+	///
+	/// Each lane produces the same samples as an `Interpolator` of the same `Type`, starting
+	/// with its current value, but advances the curve incrementally with one multiply-add per
+	/// sample (`value = value * multiplier + offset`) and lands exactly on the curve's final
+	/// value when its transition ends. Lanes that have finished their transition are tracked in
+	/// a bitmask, and groups of 64 settled lanes are skipped entirely.
+	/// @note Only the linear, logarithmic and exponential shapes can be advanced this way
+	///
+	/// @tparam T - The floating point type to perform operations in
+	/// @tparam Type - The type of interpolation
+	template<FloatingPoint T, InterpolationType Type = InterpolationType::Linear>
+	class InterpolatorBank {
+	  public:
+		static_assert(Type == InterpolationType::Linear || Type == InterpolationType::Logarithmic
+						  || Type == InterpolationType::Exponential,
+					  "InterpolatorBank only supports linear, logarithmic and exponential lanes");
+
+		static constexpr T DEFAULT_INITIAL_VALUE = Interpolator<T, Type>::DEFAULT_INITIAL_VALUE;
+		static constexpr T DEFAULT_TRANSITION_LENGTH
+			= Interpolator<T, Type>::DEFAULT_TRANSITION_LENGTH;
+		static constexpr size_t DEFAULT_SAMPLE_RATE = Interpolator<T, Type>::DEFAULT_SAMPLE_RATE;
+		/// The number of lanes tracked by each word of the active set
+		static constexpr size_t LANES_PER_ACTIVE_WORD = 64ULL;
+
+		/// @brief Creates an `InterpolatorBank` with `size` settled lanes
+		///
+		/// @param size - The number of lanes
+		/// @param sampleRate - The sample rate to process at
+		/// @param initialValue - The value every lane starts at
+		explicit InterpolatorBank(size_t size,
+								  size_t sampleRate = DEFAULT_SAMPLE_RATE,
+								  T initialValue = DEFAULT_INITIAL_VALUE)
+			: m_sample_rate(sampleRate), m_values(size, initialValue),
+			  m_multipliers(size, gsl::narrow_cast<T>(1.0)),
+			  m_offsets(size, gsl::narrow_cast<T>(0.0)), m_final_values(size, initialValue),
+			  m_samples_remaining(size, 0U), m_first_sample_pending(size, 0U),
+			  m_active((size + LANES_PER_ACTIVE_WORD - 1ULL) / LANES_PER_ACTIVE_WORD, 0ULL) {
+		}
+		InterpolatorBank(const InterpolatorBank& bank) = default;
+		InterpolatorBank(InterpolatorBank&& bank) noexcept = default;
+		~InterpolatorBank() noexcept = default;
+
+		/// @brief Returns the number of lanes in the bank
+		///
+		/// @return - The number of lanes
+		[[nodiscard]] inline auto size() const noexcept -> size_t {
+			return m_values.size();
+		}
+
+		/// @brief Returns the number of lanes still transitioning
+		///
+		/// @return - The number of active lanes
+		[[nodiscard]] inline auto num_active() const noexcept -> size_t {
+			auto active = 0ULL;
+			for(const auto word : m_active) {
+				active += gsl::narrow_cast<size_t>(std::popcount(word));
+			}
+			return active;
+		}
+
+		/// @brief Returns whether the given lane is still transitioning
+		///
+		/// @param lane - The lane to check
+		/// @return - Whether the lane is active
+		[[nodiscard]] inline auto is_active(size_t lane) const noexcept -> bool {
+			return m_samples_remaining[lane] != 0U;
+		}
+
+		/// @brief Returns the current value of the given lane
+		///
+		/// @param lane - The lane to get the value of
+		/// @return - The current value
+		[[nodiscard]] inline auto value(size_t lane) const noexcept -> T {
+			return m_values[lane];
+		}
+
+		/// @brief Returns the current values of all lanes
+		///
+		/// @return - The current values
+		[[nodiscard]] inline auto values() const noexcept -> std::span<const T> {
+			return m_values;
+		}
+
+		/// @brief Starts a transition of the given lane from its current value to `targetValue`
+		///
+		/// @param lane - The lane to set the target of
+		/// @param targetValue - The value to interpolate to
+		/// @param transitionLengthSeconds - The transition time to interpolate over
+		inline auto set_target(size_t lane,
+							   T targetValue,
+							   T transitionLengthSeconds = DEFAULT_TRANSITION_LENGTH) noexcept
+			-> void {
+			const auto initial = m_values[lane];
+			const auto samples = gsl::narrow_cast<T>(m_sample_rate) * transitionLengthSeconds;
+			const auto transitionSamples = std::min(
+				gsl::narrow_cast<size_t>(samples),
+				gsl::narrow_cast<size_t>(std::numeric_limits<std::uint32_t>::max() - 1U));
+			if(transitionSamples == 0ULL) {
+				set_value(lane, targetValue);
+				return;
+			}
+
+			if constexpr(Type == InterpolationType::Linear) {
+				m_multipliers[lane] = gsl::narrow_cast<T>(1.0);
+				m_offsets[lane] = (targetValue - initial) / samples;
+				m_final_values[lane] = targetValue;
+			}
+			else if constexpr(Type == InterpolationType::Logarithmic) {
+				const auto tau = samples / Interpolator<T, Type>::LOG_TIME_FACTOR;
+				const auto multiplier = Exponentials::exp(gsl::narrow_cast<T>(-1.0) / tau);
+				m_multipliers[lane] = multiplier;
+				m_offsets[lane] = targetValue * (gsl::narrow_cast<T>(1.0) - multiplier);
+				m_final_values[lane]
+					= (initial - targetValue)
+						  * Exponentials::exp(-gsl::narrow_cast<T>(transitionSamples) / tau)
+					  + targetValue;
+			}
+			else {
+				const auto tau = samples / Interpolator<T, Type>::EXP_TIME_FACTOR;
+				const auto multiplier = Exponentials::exp(gsl::narrow_cast<T>(1.0) / tau);
+				m_multipliers[lane] = multiplier;
+				m_offsets[lane] = (gsl::narrow_cast<T>(2.0) * initial - targetValue)
+								  * (gsl::narrow_cast<T>(1.0) - multiplier);
+				m_final_values[lane]
+					= (targetValue - initial)
+						  * (Exponentials::exp(gsl::narrow_cast<T>(transitionSamples) / tau)
+							 - gsl::narrow_cast<T>(1.0))
+					  + initial;
+			}
+
+			// like `Interpolator`, the transition's first sample is the current value, and its last
+			// is the final value `transitionSamples` steps later
+			m_samples_remaining[lane] = gsl::narrow_cast<std::uint32_t>(transitionSamples + 1ULL);
+			m_first_sample_pending[lane] = 1U;
+			m_active[lane / LANES_PER_ACTIVE_WORD] |= active_bit(lane);
+		}
+
+		/// @brief Immediately sets the given lane to `value`, ending any transition in progress
+		///
+		/// @param lane - The lane to set the value of
+		/// @param value - The new value
+		inline auto set_value(size_t lane, T value) noexcept -> void {
+			m_values[lane] = value;
+			m_final_values[lane] = value;
+			m_samples_remaining[lane] = 0U;
+			m_first_sample_pending[lane] = 0U;
+			m_active[lane / LANES_PER_ACTIVE_WORD] &= ~active_bit(lane);
+		}
+
+		/// @brief Sets the sample rate used for subsequent transitions. Transitions already in
+		/// progress are unaffected
+		///
+		/// @param sampleRate - The sample rate to use for interpolation
+		inline auto set_sample_rate(size_t sampleRate) noexcept -> void {
+			m_sample_rate = sampleRate;
+		}
+
+		/// @brief Advances every active lane by `samples` samples. Each step is performed across
+		/// 64 lanes at a time, so the compiler can vectorize it
+		///
+		/// @param samples - The number of samples to advance by
+		inline auto advance(size_t samples = 1ULL) noexcept -> void {
+			constexpr auto maxSteps = std::numeric_limits<std::uint32_t>::max();
+			const auto steps = gsl::narrow_cast<std::uint32_t>(
+				std::min(samples, gsl::narrow_cast<size_t>(maxSteps)));
+			for(auto word = 0ULL; word < m_active.size(); ++word) {
+				if(m_active[word] != 0ULL) {
+					m_active[word] = advance_lanes(word, steps);
+				}
+			}
+		}
+
+		/// @brief Fills `out` with the next `out.size()` values of the given lane, advancing it
+		///
+		/// @param lane - The lane to process
+		/// @param out - The buffer to fill with interpolation values
+		inline auto process(size_t lane, std::span<T> out) noexcept -> void {
+			auto value = m_values[lane];
+			const auto ramp = std::min<size_t>(out.size(), m_samples_remaining[lane]);
+			if(ramp != 0ULL) {
+				const auto multiplier = m_multipliers[lane];
+				const auto offset = m_offsets[lane];
+				// a transition's first sample is the value it starts from
+				const auto first = gsl::narrow_cast<size_t>(m_first_sample_pending[lane]);
+				m_first_sample_pending[lane] = 0U;
+				out[0] = value;
+				for(auto i = first; i < ramp; ++i) {
+					value = value * multiplier + offset;
+					out[i] = value;
+				}
+
+				m_samples_remaining[lane] -= gsl::narrow_cast<std::uint32_t>(ramp);
+				if(m_samples_remaining[lane] == 0U) {
+					value = m_final_values[lane];
+					out[ramp - 1ULL] = value;
+					m_active[lane / LANES_PER_ACTIVE_WORD] &= ~active_bit(lane);
+				}
+				m_values[lane] = value;
+			}
+
+			std::fill(out.begin() + gsl::narrow_cast<std::ptrdiff_t>(ramp), out.end(), value);
+		}
+
+		auto operator=(const InterpolatorBank& bank) -> InterpolatorBank& = default;
+		auto operator=(InterpolatorBank&& bank) noexcept -> InterpolatorBank& = default;
+
+	  private:
+		size_t m_sample_rate;
+		std::vector<T> m_values;
+		std::vector<T> m_multipliers;
+		std::vector<T> m_offsets;
+		/// The value each lane lands on when its transition ends
+		std::vector<T> m_final_values;
+		std::vector<std::uint32_t> m_samples_remaining;
+		/// `1` for each lane whose transition hasn't produced its first sample, its initial value,
+		/// yet; `0` otherwise
+		std::vector<std::uint32_t> m_first_sample_pending;
+		/// One bit per lane, set while the lane is transitioning
+		std::vector<std::uint64_t> m_active;
+
+		[[nodiscard]] static inline constexpr auto active_bit(size_t lane) noexcept
+			-> std::uint64_t {
+			return 1ULL << (lane % LANES_PER_ACTIVE_WORD);
+		}
+
+		/// @brief Advances the (up to) 64 lanes tracked by the given active set word by `steps`
+		/// samples
+		///
+		/// @param word - The index of the active set word
+		/// @param steps - The number of samples to advance by
+		/// @return - The updated active set word
+		inline auto advance_lanes(size_t word, std::uint32_t steps) noexcept -> std::uint64_t {
+			const auto first = word * LANES_PER_ACTIVE_WORD;
+			const auto count = std::min(LANES_PER_ACTIVE_WORD, size() - first);
+			// take raw pointers so the compiler only has to prove the arrays distinct once
+			auto* const values = m_values.data() + first;
+			const auto* const multipliers = m_multipliers.data() + first;
+			const auto* const offsets = m_offsets.data() + first;
+			const auto* const finalValues = m_final_values.data() + first;
+			auto* const remaining = m_samples_remaining.data() + first;
+			auto* const pending = m_first_sample_pending.data() + first;
+
+			// nothing changes once every lane in the group has settled, and the active set only
+			// changes once the first active lane does
+			auto longest = 0U;
+			// settled lanes wrap around to the maximum, so they're ignored
+			auto shortestMinusOne = std::numeric_limits<std::uint32_t>::max();
+			for(auto lane = 0ULL; lane < count; ++lane) {
+				longest = std::max(longest, remaining[lane]);
+				shortestMinusOne = std::min(shortestMinusOne, remaining[lane] - 1U);
+			}
+			const auto groupSteps = std::min(steps, longest);
+
+			// settled lanes, and lanes producing their first sample, step with `value * 1 + 0`. The
+			// coefficients are selected with integer masks because the compiler won't if-convert
+			// a floating point select (it could trap)
+			using Bits = UIntOfSize<T>;
+			constexpr auto oneBits = std::bit_cast<Bits>(gsl::narrow_cast<T>(1.0));
+			for(auto step = 0U; step < groupSteps; ++step) {
+				for(auto lane = 0ULL; lane < count; ++lane) {
+					const auto stepping = static_cast<Bits>(step < remaining[lane])
+										  & static_cast<Bits>(step >= pending[lane]);
+					const auto mask = Bits(0) - stepping;
+					const auto multiplier = std::bit_cast<T>(
+						(std::bit_cast<Bits>(multipliers[lane]) & mask) | (oneBits & ~mask));
+					const auto offset = std::bit_cast<T>(std::bit_cast<Bits>(offsets[lane]) & mask);
+					values[lane] = values[lane] * multiplier + offset;
+				}
+			}
+
+			for(auto lane = 0ULL; lane < count; ++lane) {
+				remaining[lane] -= std::min(groupSteps, remaining[lane]);
+				pending[lane] -= std::min(groupSteps, pending[lane]);
+			}
+			if(groupSteps <= shortestMinusOne) {
+				return m_active[word];
+			}
+
+			auto active = 0ULL;
+			for(auto lane = 0ULL; lane < count; ++lane) {
+				if(remaining[lane] == 0U) {
+					values[lane] = finalValues[lane];
+				}
+				else {
+					active |= 1ULL << lane;
+				}
+			}
+			return active;
+		}
+	};
+} // namespace hyperion::math
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <gsl/gsl>
+#include <span>
+
+#include "General.h"
+#include "HyperionUtils/Concepts.h"
+#include "HyperionUtils/Macros.h"
+#include "Interpolator.h"
+
+namespace hyperion::math {
+	using utils::concepts::FloatingPoint;
+
+	/// @brief Generates the `N` values of a transition from `initialValue` to `targetValue`
+	/// with the shape `Type`: the same values an `Interpolator<T, Type>` whose transition lasts
+	/// `N - 1` samples would produce, from the initial value to the final one.
+	/// Usable in constant evaluation, so fixed ramps (for example, short declicking fades) can be
+	/// baked into a `constexpr` table
+	///
+	/// @tparam T - The floating point type of the values
+	/// @tparam Type - The type of interpolation
+	/// @tparam N - The number of values in the ramp, at least 2
+	/// @param targetValue - The target final value to interpolate to
+	/// @param initialValue - The initial value to start interpolation from
+	///
+	/// @return - The ramp
+	template<FloatingPoint T, InterpolationType Type, size_t N>
+	[[nodiscard]] constexpr inline auto
+	make_ramp_table(T targetValue = gsl::narrow_cast<T>(1.0),
+					T initialValue = gsl::narrow_cast<T>(0.0)) noexcept -> std::array<T, N> {
+		static_assert(N >= 2ULL, "A ramp table needs at least its initial and final values");
+
+		// a one second transition at a sample rate of `N - 1` lasts exactly `N - 1` samples
+		const auto interpolator
+			= Interpolator<T, Type>(targetValue, initialValue, gsl::narrow_cast<T>(1.0), N - 1ULL);
+		auto table = std::array<T, N>();
+		for(auto i = 0ULL; i < N; ++i) {
+			table[i] = interpolator.value_at(i); // NOLINT
+		}
+		return table;
+	}
+
+	IGNORE_PADDING_START
+	/// @brief Interpolates by walking a precomputed ramp, such as one from `make_ramp_table`,
+	/// one value per sample, then holding its last value.
+	/// @note The ramp is referenced, not copied, so it must outlive the `TableInterpolator`
+	///
+	/// @tparam T - The floating point type of the values
+	/// @tparam N - The number of values in the ramp
+	template<FloatingPoint T, size_t N>
+	class TableInterpolator {
+	  public:
+		/// @brief Creates a `TableInterpolator` at the start of `table`
+		///
+		/// @param table - The ramp to walk
+		constexpr explicit TableInterpolator(const std::array<T, N>& table) noexcept
+			: m_table(table) {
+		}
+		/// The ramp is referenced, so a temporary one would dangle
+		TableInterpolator(const std::array<T, N>&& table) = delete;
+		constexpr TableInterpolator(const TableInterpolator& interpolator) noexcept = default;
+		constexpr TableInterpolator(TableInterpolator&& interpolator) noexcept = default;
+		~TableInterpolator() noexcept = default;
+
+		/// @brief Gets the next value in the ramp
+		///
+		/// @return - The interpolation value
+		constexpr inline auto get_next_value() noexcept -> T {
+			if(m_index < N) {
+				m_index++;
+			}
+			return get_current_value();
+		}
+
+		/// @brief Returns the most recently generated value, without advancing the ramp
+		///
+		/// @return - The current interpolation value
+		[[nodiscard]] constexpr inline auto get_current_value() const noexcept -> T {
+			return m_table[m_index == 0ULL ? 0ULL : m_index - 1ULL];
+		}
+
+		/// @brief Fills `out` with the next `out.size()` values in the ramp. Once the ramp has
+		/// finished, the rest of the block is filled with its last value
+		///
+		/// @param out - The buffer to fill with interpolation values
+		///
+		/// @return - Whether the ramp had already finished, so every value in `out` is the same
+		inline auto process(std::span<T> out) noexcept -> bool {
+			const auto rampLength = next_ramp_length(out.size());
+			const auto ramp = m_table.subspan(m_index, rampLength);
+			std::copy(ramp.begin(), ramp.end(), out.begin());
+			m_index += rampLength;
+			std::fill(out.begin() + gsl::narrow_cast<std::ptrdiff_t>(rampLength),
+					  out.end(),
+					  m_table.back());
+			return rampLength == 0ULL;
+		}
+
+		/// @brief Multiplies `buffer`, in place, by the next `buffer.size()` values in the ramp.
+		/// Once the ramp has finished, the rest of the block is multiplied by its last value,
+		/// unless that is exactly `1`, in which case it is left untouched
+		///
+		/// @param buffer - The buffer to apply the interpolation values to
+		///
+		/// @return - Whether the ramp had already finished, so all of `buffer` was multiplied by
+		/// the same value
+		inline auto apply(std::span<T> buffer) noexcept -> bool {
+			const auto rampLength = next_ramp_length(buffer.size());
+			const auto* ramp = m_table.data() + m_index; // NOLINT
+			for(auto i = 0ULL; i < rampLength; ++i) {
+				buffer[i] *= ramp[i]; // NOLINT
+			}
+			m_index += rampLength;
+
+			General::scale(buffer.subspan(rampLength), m_table.back());
+			return rampLength == 0ULL;
+		}
+
+		/// @brief Restarts the ramp from its first value
+		constexpr inline auto reset() noexcept -> void {
+			m_index = 0ULL;
+		}
+
+		/// @brief Returns whether the ramp has finished, so every subsequent value will be its
+		/// last value
+		///
+		/// @return - Whether this has settled
+		[[nodiscard]] constexpr inline auto is_settled() const noexcept -> bool {
+			return m_index >= N;
+		}
+
+		/// @brief Returns the number of values left in the ramp
+		///
+		/// @return - The number of remaining values, `0` if this has settled
+		[[nodiscard]] constexpr inline auto samples_remaining() const noexcept -> size_t {
+			return N - m_index;
+		}
+
+		constexpr auto operator=(const TableInterpolator& interpolator) noexcept
+			-> TableInterpolator& = default;
+		constexpr auto operator=(TableInterpolator&& interpolator) noexcept
+			-> TableInterpolator& = default;
+
+	  private:
+		std::span<const T, N> m_table;
+		size_t m_index = 0ULL;
+
+		/// @brief Gets the number of values of the next `blockSize` that are still part of the
+		/// ramp
+		///
+		/// @param blockSize - The number of values requested
+		///
+		/// @return - The number of values left in the ramp, at most `blockSize`
+		[[nodiscard]] constexpr inline auto
+		next_ramp_length(size_t blockSize) const noexcept -> size_t {
+			return std::min<size_t>(blockSize, samples_remaining());
+		}
+	};
+	IGNORE_PADDING_STOP
+} // namespace hyperion::math
@@ -1,14 +1,28 @@
 /// based on https://mklimenko.github.io/english/2018/06/04/constexpr-random/
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <bit>
+#include <concepts>
 #include <cstdint>
 #include <gsl/gsl>
+#include <functional>
 #include <limits>
 #include <random>
+#include <span>
+#include <thread>
+#include <utility>
 
 #include "HyperionUtils/Concepts.h"
 
+#if defined(__SIZEOF_INT128__)
+	#define HYPERION_MATH_HAS_INT128 1
+#else
+	#define HYPERION_MATH_HAS_INT128 0
+#endif
+
 namespace hyperion::math {
 	using gsl::narrow_cast;
 #ifndef _MSC_VER
@@ -61,7 +75,23 @@ namespace hyperion::math {
 #endif
 	// clang-format on
 
+	/// @brief Requirements for a random number engine usable with the distributions in this
+	/// file. Engines satisfying it are used directly, by value, so every call can be inlined
+	///
+	/// @tparam E - The engine type
+	template<typename E>
+	concept RandomEngine = requires(E engine, const E constEngine, size_t seed) {
+		engine.seed(seed);
+		{ constEngine.get_seed() } -> std::convertible_to<size_t>;
+		{ engine.generate() } -> std::convertible_to<size_t>;
+		{ constEngine.max_value() } -> std::convertible_to<size_t>;
+		{ engine() } -> std::convertible_to<size_t>;
+	};
+
 	IGNORE_WEAK_VTABLES_START
+	/// @brief Type-erased interface for random number engines, for when the engine has to be
+	/// chosen at runtime. Every call goes through a virtual function, so prefer using a
+	/// `RandomEngine` directly; wrap one in an `EngineAdaptor` to use it through this interface
 	class Engine {
 	  public:
 		constexpr Engine() noexcept = default;
@@ -79,6 +109,8 @@ namespace hyperion::math {
 			for(auto& element : array) {
 				element = generate();
 			}
+
+			return array;
 		}
 
 		[[nodiscard]] virtual constexpr auto max_value() const noexcept -> size_t = 0;
@@ -90,33 +122,110 @@ namespace hyperion::math {
 	};
 	IGNORE_WEAK_VTABLES_STOP
 
+	/// @brief Adapts a `RandomEngine` to the type-erased `Engine` interface
+	///
+	/// @tparam EngineType - The engine to adapt
+	template<RandomEngine EngineType>
+	class EngineAdaptor final : public Engine {
+	  public:
+		constexpr EngineAdaptor() noexcept = default;
+		/// @brief Creates an `EngineAdaptor` wrapping the given engine
+		///
+		/// @param engine - The engine to wrap
+		explicit constexpr EngineAdaptor(EngineType engine) noexcept : m_engine(engine) {
+		}
+		constexpr EngineAdaptor(const EngineAdaptor& adaptor) noexcept = default;
+		constexpr EngineAdaptor(EngineAdaptor&& adaptor) noexcept = default;
+		constexpr ~EngineAdaptor() noexcept final = default;
+
+		[[nodiscard]] inline constexpr auto get_seed() const noexcept -> size_t final {
+			return m_engine.get_seed();
+		}
+
+		inline constexpr auto seed(size_t seed) noexcept -> void final {
+			m_engine.seed(seed);
+		}
+
+		inline constexpr auto generate() noexcept -> size_t final {
+			return narrow_cast<size_t>(m_engine.generate());
+		}
+
+		[[nodiscard]] inline constexpr auto max_value() const noexcept -> size_t final {
+			return narrow_cast<size_t>(m_engine.max_value());
+		}
+
+		/// @brief Returns the wrapped engine
+		///
+		/// @return - The wrapped engine
+		[[nodiscard]] inline constexpr auto get_engine() noexcept -> EngineType& {
+			return m_engine;
+		}
+
+		constexpr auto
+		operator=(const EngineAdaptor& adaptor) noexcept -> EngineAdaptor& = default;
+		constexpr auto operator=(EngineAdaptor&& adaptor) noexcept -> EngineAdaptor& = default;
+
+		inline constexpr auto operator()() noexcept -> size_t final {
+			return narrow_cast<size_t>(m_engine.generate());
+		}
+
+	  private:
+		EngineType m_engine = EngineType();
+	};
+
 	template<size_t max = 714025>
-	class LinearCongruentialEngine final : public Engine {
+	class LinearCongruentialEngine {
 	  public:
 		constexpr LinearCongruentialEngine() noexcept = default;
 		constexpr LinearCongruentialEngine(
 			const LinearCongruentialEngine& engine) noexcept = default;
 		constexpr LinearCongruentialEngine(LinearCongruentialEngine&& engine) noexcept = default;
-		constexpr ~LinearCongruentialEngine() noexcept final = default;
+		constexpr ~LinearCongruentialEngine() noexcept = default;
 
 		IGNORE_DATETIME_START
-		[[nodiscard]] inline constexpr auto get_seed() const noexcept -> size_t final {
+		[[nodiscard]] inline constexpr auto get_seed() const noexcept -> size_t {
 			const auto* t = __TIME__;
 			return time_from_string(t, 0) * 60 * 60 + time_from_string(t, 3) * 60
 				   + time_from_string(t, 6);
 		}
 		IGNORE_DATETIME_STOP
 
-		inline constexpr auto seed(size_t seed) noexcept -> void final {
+		inline constexpr auto seed(size_t seed) noexcept -> void {
 			m_previous = seed;
 		}
 
-		[[nodiscard]] inline constexpr auto generate() noexcept -> size_t final {
+		/// @brief Advances the engine by `steps` values in `O(log(steps))` time, as if
+		/// `generate` had been called `steps` times
+		///
+		/// @param steps - The number of values to skip
+		inline constexpr auto jump(std::uint64_t steps) noexcept -> void {
+			auto multiplier = m_a % max;
+			auto increment = m_c % max;
+			for(; steps != 0U; steps >>= 1U) {
+				if((steps & 1U) != 0U) {
+					m_previous = (multiplier * m_previous + increment) % max;
+				}
+				increment = (multiplier * increment + increment) % max;
+				multiplier = (multiplier * multiplier) % max;
+			}
+		}
+
+		[[nodiscard]] inline constexpr auto generate() noexcept -> size_t {
 			m_previous = (m_a * m_previous + m_c) % max;
 			return m_previous;
 		}
 
-		[[nodiscard]] inline constexpr auto max_value() const noexcept -> size_t final {
+		template<size_t size>
+		inline constexpr auto generate_array() noexcept -> std::array<size_t, size> {
+			auto array = std::array<size_t, size>();
+			for(auto& element : array) {
+				element = generate();
+			}
+
+			return array;
+		}
+
+		[[nodiscard]] inline constexpr auto max_value() const noexcept -> size_t {
 			return max;
 		}
 
@@ -125,7 +234,7 @@ namespace hyperion::math {
 		constexpr auto operator=(LinearCongruentialEngine&& engine) noexcept
 			-> LinearCongruentialEngine& = default;
 
-		inline constexpr auto operator()() noexcept -> size_t final {
+		inline constexpr auto operator()() noexcept -> size_t {
 			return generate();
 		}
 
@@ -141,9 +250,954 @@ namespace hyperion::math {
 		}
 	};
 
+	/// @brief SplitMix64, a fast 64-bit generator with 64 bits of state. Mostly useful for
+	/// expanding one seed into the larger states of the other engines, which is how they all
+	/// seed themselves
+	class SplitMix64Engine {
+	  public:
+		using result_type = std::uint64_t;
+
+		static constexpr size_t DEFAULT_SEED = 0x853C49E6748FEA9BULL;
+
+		constexpr SplitMix64Engine() noexcept = default;
+		/// @brief Creates a `SplitMix64Engine` with the given seed
+		///
+		/// @param seed - The seed
+		explicit constexpr SplitMix64Engine(size_t seed) noexcept
+			: m_seed(seed), m_state(seed) {
+		}
+		constexpr SplitMix64Engine(const SplitMix64Engine& engine) noexcept = default;
+		constexpr SplitMix64Engine(SplitMix64Engine&& engine) noexcept = default;
+		constexpr ~SplitMix64Engine() noexcept = default;
+
+		[[nodiscard]] inline constexpr auto get_seed() const noexcept -> size_t {
+			return m_seed;
+		}
+
+		inline constexpr auto seed(size_t seed) noexcept -> void {
+			m_seed = seed;
+			m_state = seed;
+		}
+
+		/// @brief Advances the engine by `steps` values in constant time, as if `generate` had
+		/// been called `steps` times
+		///
+		/// @param steps - The number of values to skip
+		inline constexpr auto jump(std::uint64_t steps) noexcept -> void {
+			m_state += steps * GAMMA;
+		}
+
+		/// @brief Creates a child engine, seeded from this one's next value
+		///
+		/// @return - The child engine
+		[[nodiscard]] inline constexpr auto split() noexcept -> SplitMix64Engine {
+			return SplitMix64Engine(narrow_cast<size_t>(generate()));
+		}
+
+		inline constexpr auto generate() noexcept -> result_type {
+			m_state += GAMMA;
+			auto z = m_state;
+			z = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+			z = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+			return z ^ (z >> 31U);
+		}
+
+		template<size_t size>
+		inline constexpr auto generate_array() noexcept -> std::array<result_type, size> {
+			auto array = std::array<result_type, size>();
+			for(auto& element : array) {
+				element = generate();
+			}
+
+			return array;
+		}
+
+		[[nodiscard]] inline constexpr auto max_value() const noexcept -> size_t {
+			return max();
+		}
+
+		[[nodiscard]] static inline constexpr auto min() noexcept -> result_type {
+			return std::numeric_limits<result_type>::min();
+		}
+
+		[[nodiscard]] static inline constexpr auto max() noexcept -> result_type {
+			return std::numeric_limits<result_type>::max();
+		}
+
+		constexpr auto
+		operator=(const SplitMix64Engine& engine) noexcept -> SplitMix64Engine& = default;
+		constexpr auto operator=(SplitMix64Engine&& engine) noexcept -> SplitMix64Engine& = default;
+
+		inline constexpr auto operator()() noexcept -> result_type {
+			return generate();
+		}
+
+	  private:
+		static constexpr std::uint64_t GAMMA = 0x9E3779B97F4A7C15ULL;
+
+		size_t m_seed = DEFAULT_SEED;
+		std::uint64_t m_state = DEFAULT_SEED;
+	};
+
+	/// @brief xoshiro256++, a fast all-purpose 64-bit generator with 256 bits of state and a
+	/// period of 2^256 - 1. Its state is seeded by expanding the seed with SplitMix64
+	class Xoshiro256PlusPlusEngine {
+	  public:
+		using result_type = std::uint64_t;
+
+		constexpr Xoshiro256PlusPlusEngine() noexcept {
+			seed(SplitMix64Engine::DEFAULT_SEED);
+		}
+		/// @brief Creates a `Xoshiro256PlusPlusEngine` with the given seed
+		///
+		/// @param seed - The seed
+		explicit constexpr Xoshiro256PlusPlusEngine(size_t seed) noexcept {
+			this->seed(seed);
+		}
+		constexpr Xoshiro256PlusPlusEngine(const Xoshiro256PlusPlusEngine& engine) noexcept
+			= default;
+		constexpr Xoshiro256PlusPlusEngine(Xoshiro256PlusPlusEngine&& engine) noexcept = default;
+		constexpr ~Xoshiro256PlusPlusEngine() noexcept = default;
+
+		[[nodiscard]] inline constexpr auto get_seed() const noexcept -> size_t {
+			return m_seed;
+		}
+
+		inline constexpr auto seed(size_t seed) noexcept -> void {
+			m_seed = seed;
+			auto seeder = SplitMix64Engine(seed);
+			for(auto& word : m_state) {
+				word = seeder.generate();
+			}
+		}
+
+		/// @brief Advances the engine by 2^128 values, as if `generate` had been called that
+		/// many times. Calling it repeatedly gives up to 2^128 non-overlapping subsequences
+		inline constexpr auto jump() noexcept -> void {
+			apply_jump(JUMP_POLYNOMIAL);
+		}
+
+		/// @brief Advances the engine by 2^192 values, as if `generate` had been called that
+		/// many times. Gives up to 2^64 starting points, each of which can be divided
+		/// further with `jump`
+		inline constexpr auto long_jump() noexcept -> void {
+			apply_jump(LONG_JUMP_POLYNOMIAL);
+		}
+
+		/// @brief Creates a child engine that generates the next 2^128 values of this one's
+		/// sequence, then jumps this one past them, so the two never overlap
+		///
+		/// @return - The child engine
+		[[nodiscard]] inline constexpr auto split() noexcept -> Xoshiro256PlusPlusEngine {
+			auto child = *this;
+			jump();
+			return child;
+		}
+
+		inline constexpr auto generate() noexcept -> result_type {
+			auto& state = m_state;
+			const auto result = std::rotl(state[0] + state[3], 23) + state[0];
+			const auto shifted = state[1] << 17U;
+
+			state[2] ^= state[0];
+			state[3] ^= state[1];
+			state[1] ^= state[2];
+			state[0] ^= state[3];
+			state[2] ^= shifted;
+			state[3] = std::rotl(state[3], 45);
+
+			return result;
+		}
+
+		template<size_t size>
+		inline constexpr auto generate_array() noexcept -> std::array<result_type, size> {
+			auto array = std::array<result_type, size>();
+			for(auto& element : array) {
+				element = generate();
+			}
+
+			return array;
+		}
+
+		[[nodiscard]] inline constexpr auto max_value() const noexcept -> size_t {
+			return max();
+		}
+
+		[[nodiscard]] static inline constexpr auto min() noexcept -> result_type {
+			return std::numeric_limits<result_type>::min();
+		}
+
+		[[nodiscard]] static inline constexpr auto max() noexcept -> result_type {
+			return std::numeric_limits<result_type>::max();
+		}
+
+		constexpr auto operator=(const Xoshiro256PlusPlusEngine& engine) noexcept
+			-> Xoshiro256PlusPlusEngine& = default;
+		constexpr auto operator=(Xoshiro256PlusPlusEngine&& engine) noexcept
+			-> Xoshiro256PlusPlusEngine& = default;
+
+		inline constexpr auto operator()() noexcept -> result_type {
+			return generate();
+		}
+
+	  private:
+		/// The jump polynomials from the reference implementation
+		static constexpr std::array<std::uint64_t, 4> JUMP_POLYNOMIAL
+			= {0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+			   0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL};
+		static constexpr std::array<std::uint64_t, 4> LONG_JUMP_POLYNOMIAL
+			= {0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL,
+			   0x77710069854EE241ULL, 0x39109BB02ACBE635ULL};
+
+		size_t m_seed = SplitMix64Engine::DEFAULT_SEED;
+		std::array<std::uint64_t, 4> m_state = {};
+
+		/// @brief Advances the state by the jump `polynomial`, as in the reference
+		/// implementation
+		///
+		/// @param polynomial - The jump polynomial
+		inline constexpr auto
+		apply_jump(const std::array<std::uint64_t, 4>& polynomial) noexcept -> void {
+			auto state = std::array<std::uint64_t, 4>();
+			for(const auto word : polynomial) {
+				for(auto bit = 0U; bit < 64U; ++bit) {
+					if(((word >> bit) & 1U) != 0U) {
+						for(auto i = 0ULL; i < state.size(); ++i) {
+							state[i] ^= m_state[i]; // NOLINT
+						}
+					}
+					static_cast<void>(generate());
+				}
+			}
+			m_state = state;
+		}
+	};
+
+	/// @brief xoshiro128+, a fast 32-bit generator with 128 bits of state and a period of
+	/// 2^128 - 1. Its lowest bits are weak, so it is meant for generating floats, which only use
+	/// the highest. Its state is seeded by expanding the seed with SplitMix64
+	class Xoshiro128PlusEngine {
+	  public:
+		using result_type = std::uint32_t;
+
+		constexpr Xoshiro128PlusEngine() noexcept {
+			seed(SplitMix64Engine::DEFAULT_SEED);
+		}
+		/// @brief Creates a `Xoshiro128PlusEngine` with the given seed
+		///
+		/// @param seed - The seed
+		explicit constexpr Xoshiro128PlusEngine(size_t seed) noexcept {
+			this->seed(seed);
+		}
+		constexpr Xoshiro128PlusEngine(const Xoshiro128PlusEngine& engine) noexcept = default;
+		constexpr Xoshiro128PlusEngine(Xoshiro128PlusEngine&& engine) noexcept = default;
+		constexpr ~Xoshiro128PlusEngine() noexcept = default;
+
+		[[nodiscard]] inline constexpr auto get_seed() const noexcept -> size_t {
+			return m_seed;
+		}
+
+		inline constexpr auto seed(size_t seed) noexcept -> void {
+			m_seed = seed;
+			auto seeder = SplitMix64Engine(seed);
+			for(auto i = 0ULL; i < m_state.size(); i += 2ULL) {
+				const auto word = seeder.generate();
+				m_state[i] = narrow_cast<std::uint32_t>(word);			   // NOLINT
+				m_state[i + 1ULL] = narrow_cast<std::uint32_t>(word >> 32U); // NOLINT
+			}
+		}
+
+		/// @brief Advances the engine by 2^64 values, as if `generate` had been called that
+		/// many times. Calling it repeatedly gives up to 2^64 non-overlapping subsequences
+		inline constexpr auto jump() noexcept -> void {
+			apply_jump(JUMP_POLYNOMIAL);
+		}
+
+		/// @brief Advances the engine by 2^96 values, as if `generate` had been called that
+		/// many times. Gives up to 2^32 starting points, each of which can be divided
+		/// further with `jump`
+		inline constexpr auto long_jump() noexcept -> void {
+			apply_jump(LONG_JUMP_POLYNOMIAL);
+		}
+
+		/// @brief Creates a child engine that generates the next 2^64 values of this one's
+		/// sequence, then jumps this one past them, so the two never overlap
+		///
+		/// @return - The child engine
+		[[nodiscard]] inline constexpr auto split() noexcept -> Xoshiro128PlusEngine {
+			auto child = *this;
+			jump();
+			return child;
+		}
+
+		inline constexpr auto generate() noexcept -> result_type {
+			auto& state = m_state;
+			const auto result = state[0] + state[3];
+			const auto shifted = state[1] << 9U;
+
+			state[2] ^= state[0];
+			state[3] ^= state[1];
+			state[1] ^= state[2];
+			state[0] ^= state[3];
+			state[2] ^= shifted;
+			state[3] = std::rotl(state[3], 11);
+
+			return result;
+		}
+
+		template<size_t size>
+		inline constexpr auto generate_array() noexcept -> std::array<result_type, size> {
+			auto array = std::array<result_type, size>();
+			for(auto& element : array) {
+				element = generate();
+			}
+
+			return array;
+		}
+
+		[[nodiscard]] inline constexpr auto max_value() const noexcept -> size_t {
+			return max();
+		}
+
+		[[nodiscard]] static inline constexpr auto min() noexcept -> result_type {
+			return std::numeric_limits<result_type>::min();
+		}
+
+		[[nodiscard]] static inline constexpr auto max() noexcept -> result_type {
+			return std::numeric_limits<result_type>::max();
+		}
+
+		constexpr auto operator=(const Xoshiro128PlusEngine& engine) noexcept
+			-> Xoshiro128PlusEngine& = default;
+		constexpr auto
+		operator=(Xoshiro128PlusEngine&& engine) noexcept -> Xoshiro128PlusEngine& = default;
+
+		inline constexpr auto operator()() noexcept -> result_type {
+			return generate();
+		}
+
+	  private:
+		/// The jump polynomials from the reference implementation
+		static constexpr std::array<std::uint32_t, 4> JUMP_POLYNOMIAL = {
+			0x8764000BU, 0xF542D2D3U, 0x6FA035C3U, 0x77F2DB5BU};
+		static constexpr std::array<std::uint32_t, 4> LONG_JUMP_POLYNOMIAL = {
+			0xB523952EU, 0x0B6F099FU, 0xCCF5A0EFU, 0x1C580662U};
+
+		size_t m_seed = SplitMix64Engine::DEFAULT_SEED;
+		std::array<std::uint32_t, 4> m_state = {};
+
+		/// @brief Advances the state by the jump `polynomial`, as in the reference
+		/// implementation
+		///
+		/// @param polynomial - The jump polynomial
+		inline constexpr auto
+		apply_jump(const std::array<std::uint32_t, 4>& polynomial) noexcept -> void {
+			auto state = std::array<std::uint32_t, 4>();
+			for(const auto word : polynomial) {
+				for(auto bit = 0U; bit < 32U; ++bit) {
+					if(((word >> bit) & 1U) != 0U) {
+						for(auto i = 0ULL; i < state.size(); ++i) {
+							state[i] ^= m_state[i]; // NOLINT
+						}
+					}
+					static_cast<void>(generate());
+				}
+			}
+			m_state = state;
+		}
+	};
+
+	/// @brief Advances the linear congruential recurrence
+	/// `state = state * multiplier + increment`, in wrapping unsigned arithmetic, by `steps`
+	/// steps in `O(log(steps))` time
+	///
+	/// @param state - The state to advance
+	/// @param multiplier - The multiplier of the recurrence
+	/// @param increment - The increment of the recurrence
+	/// @param steps - The number of steps to advance by
+	///
+	/// @return - The advanced state
+	template<typename UInt>
+	[[nodiscard]] inline constexpr auto advance_linear_congruential(UInt state,
+																	UInt multiplier,
+																	UInt increment,
+																	std::uint64_t steps) noexcept
+		-> UInt {
+		// square the recurrence once per bit of `steps`, applying it wherever that bit is set
+		for(; steps != 0U; steps >>= 1U) {
+			if((steps & 1U) != 0U) {
+				state = state * multiplier + increment;
+			}
+			increment = multiplier * increment + increment;
+			multiplier = multiplier * multiplier;
+		}
+		return state;
+	}
+
+	/// @brief PCG32 (PCG-XSH-RR with 64 bits of state), a fast 32-bit generator with a period of
+	/// 2^64. Each of its 2^63 streams is an independent sequence.
+	/// Matches the reference `pcg32`: seeding with `seed` and `stream` is equivalent to
+	/// `pcg32_srandom_r(rng, seed, stream)`
+	class Pcg32Engine {
+	  public:
+		using result_type = std::uint32_t;
+
+		static constexpr std::uint64_t MULTIPLIER = 6364136223846793005ULL;
+		static constexpr std::uint64_t DEFAULT_STREAM = 0x0A02BDBF7BB3C0A7ULL;
+
+		constexpr Pcg32Engine() noexcept {
+			seed(SplitMix64Engine::DEFAULT_SEED);
+		}
+		/// @brief Creates a `Pcg32Engine` with the given seed, on the given stream
+		///
+		/// @param seed - The seed
+		/// @param stream - The stream to generate
+		explicit constexpr Pcg32Engine(size_t seed, std::uint64_t stream = DEFAULT_STREAM) noexcept
+			: m_increment((stream << 1U) | 1U) {
+			this->seed(seed);
+		}
+		constexpr Pcg32Engine(const Pcg32Engine& engine) noexcept = default;
+		constexpr Pcg32Engine(Pcg32Engine&& engine) noexcept = default;
+		constexpr ~Pcg32Engine() noexcept = default;
+
+		[[nodiscard]] inline constexpr auto get_seed() const noexcept -> size_t {
+			return m_seed;
+		}
+
+		/// @brief Reseeds the engine, keeping its stream
+		///
+		/// @param seed - The seed
+		inline constexpr auto seed(size_t seed) noexcept -> void {
+			m_seed = seed;
+			m_state = 0U;
+			step();
+			m_state += seed;
+			step();
+		}
+
+		/// @brief Returns the stream this generates
+		///
+		/// @return - The stream
+		[[nodiscard]] inline constexpr auto get_stream() const noexcept -> std::uint64_t {
+			return m_increment >> 1U;
+		}
+
+		/// @brief Advances the engine by `steps` values in `O(log(steps))` time, as if
+		/// `generate` had been called `steps` times
+		///
+		/// @param steps - The number of values to skip
+		inline constexpr auto jump(std::uint64_t steps) noexcept -> void {
+			m_state = advance_linear_congruential(m_state, MULTIPLIER, m_increment, steps);
+		}
+
+		/// @brief Creates a child engine on a new stream, with its seed and stream drawn from
+		/// this one
+		///
+		/// @return - The child engine
+		[[nodiscard]] inline constexpr auto split() noexcept -> Pcg32Engine {
+			const auto seed = draw_64_bits();
+			const auto stream = draw_64_bits();
+			return Pcg32Engine(narrow_cast<size_t>(seed), stream);
+		}
+
+		inline constexpr auto generate() noexcept -> result_type {
+			const auto state = m_state;
+			step();
+
+			const auto xorShifted = narrow_cast<std::uint32_t>(((state >> 18U) ^ state) >> 27U);
+			const auto rotation = narrow_cast<int>(state >> 59U);
+			return std::rotr(xorShifted, rotation);
+		}
+
+		template<size_t size>
+		inline constexpr auto generate_array() noexcept -> std::array<result_type, size> {
+			auto array = std::array<result_type, size>();
+			for(auto& element : array) {
+				element = generate();
+			}
+
+			return array;
+		}
+
+		[[nodiscard]] inline constexpr auto max_value() const noexcept -> size_t {
+			return max();
+		}
+
+		[[nodiscard]] static inline constexpr auto min() noexcept -> result_type {
+			return std::numeric_limits<result_type>::min();
+		}
+
+		[[nodiscard]] static inline constexpr auto max() noexcept -> result_type {
+			return std::numeric_limits<result_type>::max();
+		}
+
+		constexpr auto operator=(const Pcg32Engine& engine) noexcept -> Pcg32Engine& = default;
+		constexpr auto operator=(Pcg32Engine&& engine) noexcept -> Pcg32Engine& = default;
+
+		inline constexpr auto operator()() noexcept -> result_type {
+			return generate();
+		}
+
+	  private:
+		size_t m_seed = SplitMix64Engine::DEFAULT_SEED;
+		std::uint64_t m_state = 0U;
+		std::uint64_t m_increment = (DEFAULT_STREAM << 1U) | 1U;
+
+		inline constexpr auto step() noexcept -> void {
+			m_state = m_state * MULTIPLIER + m_increment;
+		}
+
+		/// @brief Combines the next two values into 64 bits
+		///
+		/// @return - The combined value
+		inline constexpr auto draw_64_bits() noexcept -> std::uint64_t {
+			const auto high = narrow_cast<std::uint64_t>(generate());
+			const auto low = narrow_cast<std::uint64_t>(generate());
+			return (high << 32U) | low;
+		}
+	};
+
+	/// @brief An unsigned 128-bit integer, with just the arithmetic `Pcg64Engine` needs
+	struct UInt128 {
+		std::uint64_t high = 0U;
+		std::uint64_t low = 0U;
+
+		[[nodiscard]] friend inline constexpr auto
+		operator+(UInt128 left, UInt128 right) noexcept -> UInt128 {
+			const auto low = left.low + right.low;
+			const auto carry = low < left.low ? 1U : 0U;
+			return {left.high + right.high + carry, low};
+		}
+
+		[[nodiscard]] friend inline constexpr auto
+		operator*(UInt128 left, UInt128 right) noexcept -> UInt128 {
+			return {multiply_high(left.low, right.low) + left.low * right.high
+						+ left.high * right.low,
+					left.low * right.low};
+		}
+
+		/// @brief Calculates the high 64 bits of the 128-bit product of `left` and `right`
+		///
+		/// @param left - The left operand
+		/// @param right - The right operand
+		///
+		/// @return - The high half of the product
+		[[nodiscard]] static inline constexpr auto
+		multiply_high(std::uint64_t left, std::uint64_t right) noexcept -> std::uint64_t {
+#if HYPERION_MATH_HAS_INT128
+			return narrow_cast<std::uint64_t>(
+				(narrow_cast<__uint128_t>(left) * narrow_cast<__uint128_t>(right)) >> 64U);
+#else
+			constexpr auto mask = 0xFFFFFFFFULL;
+			const auto leftLow = left & mask;
+			const auto leftHigh = left >> 32U;
+			const auto rightLow = right & mask;
+			const auto rightHigh = right >> 32U;
+
+			const auto lowLow = leftLow * rightLow;
+			const auto highLow = leftHigh * rightLow;
+			const auto lowHigh = leftLow * rightHigh;
+			const auto middle = (lowLow >> 32U) + (highLow & mask) + lowHigh;
+			return leftHigh * rightHigh + (highLow >> 32U) + (middle >> 32U);
+#endif
+		}
+	};
+
+	/// @brief PCG64 (PCG-XSL-RR with 128 bits of state), a fast 64-bit generator with a period
+	/// of 2^128. Each of its 2^127 streams is an independent sequence.
+	/// Matches the reference `pcg64`: seeding with `seed` is equivalent to `pcg64(seed)`
+	class Pcg64Engine {
+	  public:
+		using result_type = std::uint64_t;
+
+		static constexpr UInt128 MULTIPLIER = {0x2360ED051FC65DA4ULL, 0x4385DF649FCCF645ULL};
+		static constexpr UInt128 DEFAULT_INCREMENT = {0x5851F42D4C957F2DULL, 0x14057B7EF767814FULL};
+
+		constexpr Pcg64Engine() noexcept {
+			seed(SplitMix64Engine::DEFAULT_SEED);
+		}
+		/// @brief Creates a `Pcg64Engine` with the given seed, on the given stream
+		///
+		/// @param seed - The seed
+		/// @param stream - The stream to generate
+		explicit constexpr Pcg64Engine(size_t seed, UInt128 stream) noexcept
+			: m_increment({(stream.high << 1U) | (stream.low >> 63U), (stream.low << 1U) | 1U}) {
+			this->seed(seed);
+		}
+		/// @brief Creates a `Pcg64Engine` with the given seed, on the default stream
+		///
+		/// @param seed - The seed
+		explicit constexpr Pcg64Engine(size_t seed) noexcept {
+			this->seed(seed);
+		}
+		constexpr Pcg64Engine(const Pcg64Engine& engine) noexcept = default;
+		constexpr Pcg64Engine(Pcg64Engine&& engine) noexcept = default;
+		constexpr ~Pcg64Engine() noexcept = default;
+
+		[[nodiscard]] inline constexpr auto get_seed() const noexcept -> size_t {
+			return m_seed;
+		}
+
+		/// @brief Reseeds the engine, keeping its stream
+		///
+		/// @param seed - The seed
+		inline constexpr auto seed(size_t seed) noexcept -> void {
+			m_seed = seed;
+			m_state = UInt128{0U, seed} + m_increment;
+			step();
+		}
+
+		/// @brief Advances the engine by `steps` values in `O(log(steps))` time, as if
+		/// `generate` had been called `steps` times
+		///
+		/// @param steps - The number of values to skip
+		inline constexpr auto jump(std::uint64_t steps) noexcept -> void {
+			m_state = advance_linear_congruential(m_state, MULTIPLIER, m_increment, steps);
+		}
+
+		/// @brief Creates a child engine on a new stream, with its seed and stream drawn from
+		/// this one
+		///
+		/// @return - The child engine
+		[[nodiscard]] inline constexpr auto split() noexcept -> Pcg64Engine {
+			const auto seed = generate();
+			const auto streamHigh = generate();
+			const auto streamLow = generate();
+			return Pcg64Engine(narrow_cast<size_t>(seed), UInt128{streamHigh, streamLow});
+		}
+
+		inline constexpr auto generate() noexcept -> result_type {
+			step();
+			const auto rotation = narrow_cast<int>(m_state.high >> 58U);
+			return std::rotr(m_state.high ^ m_state.low, rotation);
+		}
+
+		template<size_t size>
+		inline constexpr auto generate_array() noexcept -> std::array<result_type, size> {
+			auto array = std::array<result_type, size>();
+			for(auto& element : array) {
+				element = generate();
+			}
+
+			return array;
+		}
+
+		[[nodiscard]] inline constexpr auto max_value() const noexcept -> size_t {
+			return max();
+		}
+
+		[[nodiscard]] static inline constexpr auto min() noexcept -> result_type {
+			return std::numeric_limits<result_type>::min();
+		}
+
+		[[nodiscard]] static inline constexpr auto max() noexcept -> result_type {
+			return std::numeric_limits<result_type>::max();
+		}
+
+		constexpr auto operator=(const Pcg64Engine& engine) noexcept -> Pcg64Engine& = default;
+		constexpr auto operator=(Pcg64Engine&& engine) noexcept -> Pcg64Engine& = default;
+
+		inline constexpr auto operator()() noexcept -> result_type {
+			return generate();
+		}
+
+	  private:
+		size_t m_seed = SplitMix64Engine::DEFAULT_SEED;
+		UInt128 m_state = {};
+		UInt128 m_increment = DEFAULT_INCREMENT;
+
+		inline constexpr auto step() noexcept -> void {
+			m_state = m_state * MULTIPLIER + m_increment;
+		}
+	};
+
+	/// @brief Philox4x32-10, a counter-based generator: each 128-bit counter is turned into four
+	/// random 32-bit values by ten rounds of a keyed bijection, with no sequential state.
+	/// Any (key, counter) pair can be evaluated directly with `block`, so parallel work can give
+	/// every item (for example, every pixel or sample index) its own reproducible stream without
+	/// any coordination between threads.
+	///
+	/// The key is the seed. The counter's high 64 bits select the stream and its low 64 bits the
+	/// position within it, so each of the 2^64 streams of a key is 2^64 blocks long.
+	/// Matches the Random123 reference `philox4x32_R(10, counter, key)`
+	class Philox4x32Engine {
+	  public:
+		using result_type = std::uint32_t;
+		using Counter = std::array<std::uint32_t, 4>;
+		using Key = std::array<std::uint32_t, 2>;
+
+		/// The number of blocks `fill` generates at a time
+		static constexpr size_t BATCH_BLOCKS = 32ULL;
+
+		constexpr Philox4x32Engine() noexcept {
+			seed(SplitMix64Engine::DEFAULT_SEED);
+		}
+		/// @brief Creates a `Philox4x32Engine` with the given seed, on the given stream
+		///
+		/// @param seed - The seed, used as the key
+		/// @param stream - The stream to generate
+		explicit constexpr Philox4x32Engine(size_t seed, std::uint64_t stream = 0U) noexcept
+			: m_stream(stream) {
+			this->seed(seed);
+		}
+		constexpr Philox4x32Engine(const Philox4x32Engine& engine) noexcept = default;
+		constexpr Philox4x32Engine(Philox4x32Engine&& engine) noexcept = default;
+		constexpr ~Philox4x32Engine() noexcept = default;
+
+		/// @brief Generates the four values for `counter` under `key`
+		///
+		/// @param counter - The counter to generate the values for
+		/// @param key - The key to generate the values with
+		///
+		/// @return - The four values
+		[[nodiscard]] static inline constexpr auto
+		block(Counter counter, Key key) noexcept -> std::array<result_type, 4> {
+			for(auto round = 0; round < ROUNDS; ++round) {
+				if(round != 0) {
+					key[0] += KEY_BUMP_0;
+					key[1] += KEY_BUMP_1;
+				}
+				const auto product0 = narrow_cast<std::uint64_t>(MULTIPLIER_0) * counter[0];
+				const auto product1 = narrow_cast<std::uint64_t>(MULTIPLIER_1) * counter[2];
+				counter = {narrow_cast<std::uint32_t>(product1 >> 32U) ^ counter[1] ^ key[0],
+						   narrow_cast<std::uint32_t>(product1),
+						   narrow_cast<std::uint32_t>(product0 >> 32U) ^ counter[3] ^ key[1],
+						   narrow_cast<std::uint32_t>(product0)};
+			}
+			return counter;
+		}
+
+		[[nodiscard]] inline constexpr auto get_seed() const noexcept -> size_t {
+			return m_seed;
+		}
+
+		/// @brief Reseeds the engine, restarting its stream from the beginning
+		///
+		/// @param seed - The seed, used as the key
+		inline constexpr auto seed(size_t seed) noexcept -> void {
+			m_seed = seed;
+			const auto key = narrow_cast<std::uint64_t>(seed);
+			m_key = {narrow_cast<std::uint32_t>(key), narrow_cast<std::uint32_t>(key >> 32U)};
+			m_block_index = 0U;
+			m_buffer_index = m_buffer.size();
+		}
+
+		/// @brief Returns the stream this generates
+		///
+		/// @return - The stream
+		[[nodiscard]] inline constexpr auto get_stream() const noexcept -> std::uint64_t {
+			return m_stream;
+		}
+
+		/// @brief Advances the engine by `steps` values in constant time, as if `generate` had
+		/// been called `steps` times
+		///
+		/// @param steps - The number of values to skip
+		inline constexpr auto jump(std::uint64_t steps) noexcept -> void {
+			const auto bufferSize = narrow_cast<std::uint64_t>(m_buffer.size());
+			// the position in the stream of the next value, counted in values
+			const auto position = m_block_index * bufferSize
+								  - (bufferSize - narrow_cast<std::uint64_t>(m_buffer_index))
+								  + steps;
+			m_block_index = position / bufferSize;
+			m_buffer_index = m_buffer.size();
+			const auto offset = narrow_cast<size_t>(position % bufferSize);
+			if(offset != 0ULL) {
+				static_cast<void>(generate());
+				m_buffer_index = offset;
+			}
+		}
+
+		/// @brief Creates a child engine on this one's stream, keyed with a seed drawn from
+		/// this one
+		///
+		/// @return - The child engine
+		[[nodiscard]] inline constexpr auto split() noexcept -> Philox4x32Engine {
+			const auto high = narrow_cast<std::uint64_t>(generate());
+			const auto low = narrow_cast<std::uint64_t>(generate());
+			return Philox4x32Engine(narrow_cast<size_t>((high << 32U) | low), m_stream);
+		}
+
+		inline constexpr auto generate() noexcept -> result_type {
+			if(m_buffer_index == m_buffer.size()) {
+				m_buffer = block(counter_at(m_block_index), m_key);
+				m_block_index++;
+				m_buffer_index = 0ULL;
+			}
+			return m_buffer[m_buffer_index++]; // NOLINT
+		}
+
+		/// @brief Fills `out` with the next `out.size()` values, the same values as that many
+		/// calls to `generate`. Whole blocks are generated `BATCH_BLOCKS` at a time in a loop the
+		/// compiler can vectorize
+		///
+		/// @param out - The buffer to fill
+		inline auto fill(std::span<result_type> out) noexcept -> void {
+			auto index = 0ULL;
+			for(; index < out.size() && m_buffer_index < m_buffer.size(); ++index) {
+				out[index] = m_buffer[m_buffer_index++]; // NOLINT
+			}
+
+			for(; out.size() - index >= BATCH_VALUES; index += BATCH_VALUES) {
+				generate_batch(out.subspan(index).first<BATCH_VALUES>());
+			}
+
+			for(; index < out.size(); ++index) {
+				out[index] = generate();
+			}
+		}
+
+		/// @brief Fills `out` with values uniformly distributed over `[min, max)`
+		///
+		/// @param out - The buffer to fill
+		/// @param min - The minimum value to generate
+		/// @param max - The maximum value to generate
+		template<utils::concepts::FloatingPoint T>
+		inline auto fill_uniform(std::span<T> out,
+								 T min = narrow_cast<T>(0),
+								 T max = narrow_cast<T>(1)) noexcept -> void {
+			// use as many of the high bits as fit in the mantissa, so the result is below `1`
+			constexpr auto shift = std::numeric_limits<T>::digits < 32
+									   ? 32U - narrow_cast<unsigned>(std::numeric_limits<T>::digits)
+									   : 0U;
+			const auto scale = (max - min) / narrow_cast<T>(1ULL << (32U - shift));
+
+			auto values = std::array<result_type, BATCH_VALUES>();
+			for(auto index = 0ULL; index < out.size(); index += BATCH_VALUES) {
+				const auto count = std::min<size_t>(BATCH_VALUES, out.size() - index);
+				fill(std::span<result_type>(values).first(count));
+				for(auto i = 0ULL; i < count; ++i) {
+					out[index + i] = narrow_cast<T>(values[i] >> shift) * scale + min; // NOLINT
+				}
+			}
+		}
+
+		template<size_t size>
+		inline constexpr auto generate_array() noexcept -> std::array<result_type, size> {
+			auto array = std::array<result_type, size>();
+			for(auto& element : array) {
+				element = generate();
+			}
+
+			return array;
+		}
+
+		[[nodiscard]] inline constexpr auto max_value() const noexcept -> size_t {
+			return max();
+		}
+
+		[[nodiscard]] static inline constexpr auto min() noexcept -> result_type {
+			return std::numeric_limits<result_type>::min();
+		}
+
+		[[nodiscard]] static inline constexpr auto max() noexcept -> result_type {
+			return std::numeric_limits<result_type>::max();
+		}
+
+		constexpr auto
+		operator=(const Philox4x32Engine& engine) noexcept -> Philox4x32Engine& = default;
+		constexpr auto operator=(Philox4x32Engine&& engine) noexcept -> Philox4x32Engine& = default;
+
+		inline constexpr auto operator()() noexcept -> result_type {
+			return generate();
+		}
+
+	  private:
+		static constexpr int ROUNDS = 10;
+		static constexpr std::uint32_t MULTIPLIER_0 = 0xD2511F53U;
+		static constexpr std::uint32_t MULTIPLIER_1 = 0xCD9E8D57U;
+		static constexpr std::uint32_t KEY_BUMP_0 = 0x9E3779B9U;
+		static constexpr std::uint32_t KEY_BUMP_1 = 0xBB67AE85U;
+		static constexpr size_t BATCH_VALUES = BATCH_BLOCKS * 4ULL;
+
+		size_t m_seed = SplitMix64Engine::DEFAULT_SEED;
+		Key m_key = {};
+		std::uint64_t m_stream = 0U;
+		/// The position in the stream of the next block to generate
+		std::uint64_t m_block_index = 0U;
+		std::array<result_type, 4> m_buffer = {};
+		size_t m_buffer_index = 4ULL;
+
+		/// @brief Gets the counter for the block at `blockIndex` in this engine's stream
+		///
+		/// @param blockIndex - The position of the block in the stream
+		///
+		/// @return - The counter
+		[[nodiscard]] inline constexpr auto
+		counter_at(std::uint64_t blockIndex) const noexcept -> Counter {
+			return {narrow_cast<std::uint32_t>(blockIndex),
+					narrow_cast<std::uint32_t>(blockIndex >> 32U),
+					narrow_cast<std::uint32_t>(m_stream),
+					narrow_cast<std::uint32_t>(m_stream >> 32U)};
+		}
+
+		/// @brief Generates the next `BATCH_BLOCKS` blocks into `out`. The blocks are transposed
+		/// so each round is computed for every block in one loop, which the compiler vectorizes
+		///
+		/// @param out - The buffer to fill
+		inline auto generate_batch(std::span<result_type, BATCH_VALUES> out) noexcept -> void {
+			auto counters = std::array<std::array<std::uint32_t, BATCH_BLOCKS>, 4>();
+			for(auto i = 0ULL; i < BATCH_BLOCKS; ++i) {
+				const auto counter = counter_at(m_block_index + i);
+				for(auto word = 0ULL; word < counter.size(); ++word) {
+					counters[word][i] = counter[word]; // NOLINT
+				}
+			}
+			m_block_index += BATCH_BLOCKS;
+
+			auto key = m_key;
+			for(auto round = 0; round < ROUNDS; ++round) {
+				if(round != 0) {
+					key[0] += KEY_BUMP_0;
+					key[1] += KEY_BUMP_1;
+				}
+				for(auto i = 0ULL; i < BATCH_BLOCKS; ++i) {
+					const auto product0 = narrow_cast<std::uint64_t>(MULTIPLIER_0) * counters[0][i];
+					const auto product1 = narrow_cast<std::uint64_t>(MULTIPLIER_1) * counters[2][i];
+					counters[0][i] = narrow_cast<std::uint32_t>(product1 >> 32U) ^ counters[1][i]
+									 ^ key[0];
+					counters[1][i] = narrow_cast<std::uint32_t>(product1);
+					counters[2][i] = narrow_cast<std::uint32_t>(product0 >> 32U) ^ counters[3][i]
+									 ^ key[1];
+					counters[3][i] = narrow_cast<std::uint32_t>(product0);
+				}
+			}
+
+			for(auto i = 0ULL; i < BATCH_BLOCKS; ++i) {
+				for(auto word = 0ULL; word < counters.size(); ++word) {
+					out[i * 4ULL + word] = counters[word][i]; // NOLINT
+				}
+			}
+		}
+	};
+
+	/// @brief Requirements for a random number distribution. Distributions satisfying it are
+	/// used directly, by value, so every call can be inlined
+	///
+	/// @tparam D - The distribution type
+	template<typename D>
+	concept RandomDistribution = requires(D distribution,
+										  const D constDistribution,
+										  typename D::value_type value,
+										  size_t seed) {
+		requires RandomEngine<typename D::engine_type>;
+		{ distribution.normalized_random_value() } -> std::convertible_to<double>;
+		{ distribution.random_value() } -> std::convertible_to<typename D::value_type>;
+		{ distribution() } -> std::convertible_to<typename D::value_type>;
+		distribution.seed(seed);
+		{ distribution.get_seed() } -> std::convertible_to<size_t>;
+		{ constDistribution.get_min() } -> std::convertible_to<typename D::value_type>;
+		distribution.set_min(value);
+		{ constDistribution.get_max() } -> std::convertible_to<typename D::value_type>;
+		distribution.set_max(value);
+	};
+
 	IGNORE_WEAK_VTABLES_START
-	template<typename EngineType, utils::concepts::Numeric T = int>
-	requires utils::concepts::Derived<EngineType, Engine>
+	/// @brief Type-erased interface for random number distributions, for when the distribution
+	/// has to be chosen at runtime. Every call goes through a virtual function, so prefer using
+	/// a `RandomDistribution` directly; wrap one in a `DistributionAdaptor` to use it through
+	/// this interface
+	template<RandomEngine EngineType, utils::concepts::Numeric T = int>
 	class Distribution {
 	  public:
 		constexpr Distribution() noexcept = default;
@@ -187,129 +1241,256 @@ namespace hyperion::math {
 	};
 	IGNORE_WEAK_VTABLES_STOP
 
-	template<typename EngineType, utils::concepts::Numeric T = int>
-	requires utils::concepts::Derived<EngineType, Engine>
-	class UniformDistribution final : public Distribution<EngineType, T> {
+	/// @brief Adapts a `RandomDistribution` to the type-erased `Distribution` interface
+	///
+	/// @tparam DistributionType - The distribution to adapt
+	template<RandomDistribution DistributionType>
+	class DistributionAdaptor final
+		: public Distribution<typename DistributionType::engine_type,
+							  typename DistributionType::value_type> {
+	  public:
+		using value_type = typename DistributionType::value_type;
+
+		constexpr DistributionAdaptor() noexcept = default;
+		/// @brief Creates a `DistributionAdaptor` wrapping the given distribution
+		///
+		/// @param distribution - The distribution to wrap
+		explicit constexpr DistributionAdaptor(DistributionType distribution) noexcept
+			: m_distribution(distribution) {
+		}
+		constexpr DistributionAdaptor(const DistributionAdaptor& adaptor) noexcept = default;
+		constexpr DistributionAdaptor(DistributionAdaptor&& adaptor) noexcept = default;
+		constexpr ~DistributionAdaptor() noexcept final = default;
+
+		inline constexpr auto normalized_random_value() noexcept -> double final {
+			return m_distribution.normalized_random_value();
+		}
+
+		inline constexpr auto random_value() noexcept -> value_type final {
+			return m_distribution.random_value();
+		}
+
+		inline constexpr auto seed(size_t seed) noexcept -> void final {
+			m_distribution.seed(seed);
+		}
+
+		[[nodiscard]] inline constexpr auto get_seed() noexcept -> size_t final {
+			return m_distribution.get_seed();
+		}
+
+		inline constexpr auto set_min(value_type min) noexcept -> void final {
+			m_distribution.set_min(min);
+		}
+		[[nodiscard]] inline constexpr auto get_min() const noexcept -> value_type final {
+			return m_distribution.get_min();
+		}
+
+		inline constexpr auto set_max(value_type max) noexcept -> void final {
+			m_distribution.set_max(max);
+		}
+		[[nodiscard]] inline constexpr auto get_max() const noexcept -> value_type final {
+			return m_distribution.get_max();
+		}
+
+		/// @brief Returns the wrapped distribution
+		///
+		/// @return - The wrapped distribution
+		[[nodiscard]] inline constexpr auto get_distribution() noexcept -> DistributionType& {
+			return m_distribution;
+		}
+
+		constexpr auto
+		operator=(const DistributionAdaptor& adaptor) noexcept -> DistributionAdaptor& = default;
+		constexpr auto
+		operator=(DistributionAdaptor&& adaptor) noexcept -> DistributionAdaptor& = default;
+
+		inline constexpr auto operator()() noexcept -> value_type final {
+			return m_distribution.random_value();
+		}
+
+	  private:
+		DistributionType m_distribution = DistributionType();
+	};
+
+	/// @brief Uniformly distributes the values of a `RandomEngine` over `[min, max]`.
+	/// The engine is held by value, so drawing a value doesn't go through any indirection
+	///
+	/// @tparam EngineType - The engine to draw from
+	/// @tparam T - The type of the generated values
+	template<RandomEngine EngineType, utils::concepts::Numeric T = int>
+	class UniformDistribution {
 	  public:
+		using engine_type = EngineType;
+		using value_type = T;
+
 		constexpr UniformDistribution() noexcept requires
-			utils::concepts::DefaultConstructible<EngineType>
-			: m_engine(std::make_unique<EngineType>()) {
-			m_engine->seed(m_engine->get_seed());
+			utils::concepts::DefaultConstructible<EngineType> {
+			m_engine.seed(m_engine.get_seed());
 		}
 		constexpr UniformDistribution(T min, T max) noexcept requires
 			utils::concepts::DefaultConstructible<EngineType>
-			: m_min(min), m_max(max), m_engine(std::make_unique<EngineType>()) {
-			m_engine->seed(m_engine->get_seed());
+			: m_min(min), m_max(max) {
+			m_engine.seed(m_engine.get_seed());
 		}
-		constexpr UniformDistribution(T min, T max, std::unique_ptr<EngineType>&& engine) noexcept
-			: m_min(min), m_max(max), m_engine(engine) {
-			m_engine->seed(m_engine->get_seed());
+		/// @brief Creates a `UniformDistribution` drawing from the given engine, which is used
+		/// with whatever seed it already has
+		///
+		/// @param min - The minimum value to generate
+		/// @param max - The maximum value to generate
+		/// @param engine - The engine to draw from
+		constexpr UniformDistribution(T min, T max, EngineType engine) noexcept
+			: m_min(min), m_max(max), m_engine(std::move(engine)) {
 		}
-		explicit constexpr UniformDistribution(std::unique_ptr<EngineType>&& engine) noexcept
+		/// @brief Creates a `UniformDistribution` drawing from the given engine, which is used
+		/// with whatever seed it already has
+		///
+		/// @param engine - The engine to draw from
+		explicit constexpr UniformDistribution(EngineType engine) noexcept
 			: m_engine(std::move(engine)) {
-			m_engine->seed(m_engine->get_seed());
-		}
-		template<typename... Args>
-		requires utils::concepts::Derived<EngineType, Engine> && utils::concepts::
-			ConstructibleFrom<EngineType, Args...>
-		explicit constexpr UniformDistribution(Args&&... args) noexcept
-			: m_engine(std::make_unique<EngineType>(args...)) {
-			m_engine->seed(m_engine->get_seed());
-		}
-		template<typename... Args>
-		requires utils::concepts::Derived<EngineType, Engine> && utils::concepts::
-			ConstructibleFrom<EngineType, Args...>
-		explicit constexpr UniformDistribution(T min, T max, Args&&... args) noexcept
-			: m_min(min), m_max(max), m_engine(std::make_unique<EngineType>(args...)) {
-			m_engine->seed(m_engine->get_seed());
 		}
 		constexpr UniformDistribution(const UniformDistribution& distribution) noexcept = default;
 		constexpr UniformDistribution(UniformDistribution&& distribution) noexcept = default;
 
-		constexpr ~UniformDistribution() noexcept final = default;
+		constexpr ~UniformDistribution() noexcept = default;
 
-		inline constexpr auto normalized_random_value() noexcept -> double final {
-			return narrow_cast<double>(m_engine->generate())
-				   / narrow_cast<double>(m_engine->max_value());
+		inline constexpr auto normalized_random_value() noexcept -> double {
+			return narrow_cast<double>(m_engine.generate())
+				   / narrow_cast<double>(m_engine.max_value());
 		}
 
-		inline constexpr auto random_value() noexcept -> T final {
-			return narrow_cast<T>(this->normalized_random_value()) * (m_max - m_min) + m_min;
+		inline constexpr auto random_value() noexcept -> T {
+			return narrow_cast<T>(normalized_random_value()) * (m_max - m_min) + m_min;
 		}
 
-		inline constexpr auto seed(size_t seed) noexcept -> void final {
-			m_engine->seed(seed);
+		template<size_t size>
+		inline constexpr auto normalized_random_values() noexcept -> std::array<double, size> {
+			auto array = std::array<double, size>();
+			for(auto& element : array) {
+				element = normalized_random_value();
+			}
+
+			return array;
 		}
 
-		[[nodiscard]] inline constexpr auto get_seed() noexcept -> size_t final {
-			return m_engine->get_seed();
+		template<size_t size>
+		inline constexpr auto random_values() noexcept -> std::array<T, size> {
+			auto array = std::array<T, size>();
+			for(auto& element : array) {
+				element = random_value();
+			}
+
+			return array;
+		}
+
+		inline constexpr auto seed(size_t seed) noexcept -> void {
+			m_engine.seed(seed);
 		}
 
-		inline constexpr auto set_min(T min) noexcept -> void final {
+		[[nodiscard]] inline constexpr auto get_seed() noexcept -> size_t {
+			return m_engine.get_seed();
+		}
+
+		inline constexpr auto set_min(T min) noexcept -> void {
 			m_min = min;
 		}
-		[[nodiscard]] inline constexpr auto get_min() const noexcept -> T final {
+		[[nodiscard]] inline constexpr auto get_min() const noexcept -> T {
 			return m_min;
 		}
 
-		inline constexpr auto set_max(T max) noexcept -> void final {
+		inline constexpr auto set_max(T max) noexcept -> void {
 			m_max = max;
 		}
-		[[nodiscard]] inline constexpr auto get_max() const noexcept -> T final {
+		[[nodiscard]] inline constexpr auto get_max() const noexcept -> T {
 			return m_max;
 		}
 
+		/// @brief Returns the engine this draws from
+		///
+		/// @return - The engine
+		[[nodiscard]] inline constexpr auto get_engine() noexcept -> EngineType& {
+			return m_engine;
+		}
+
 		constexpr auto operator=(const UniformDistribution& distribution) noexcept
 			-> UniformDistribution& = default;
 		constexpr auto
 		operator=(UniformDistribution&& distribution) noexcept -> UniformDistribution& = default;
 
-		inline constexpr auto operator()() noexcept -> T final {
+		inline constexpr auto operator()() noexcept -> T {
 			return random_value();
 		}
 
 	  private:
 		T m_min = narrow_cast<T>(0);
 		T m_max = narrow_cast<T>(1);
-		std::unique_ptr<EngineType> m_engine;
+		EngineType m_engine = EngineType();
 	};
 
-	template<utils::concepts::Numeric T = float>
-	[[clang::no_destroy]] static math::UniformDistribution<math::LinearCongruentialEngine<>, T>
-		GLOBAL_UNIFORM_DISTRIBUTION;
-
-	template<utils::concepts::Numeric T = float>
-	static std::atomic_bool GLOBAL_UNIFORM_DISTRIBUTION_INITIALIZED;
+	/// @brief Creates a seed for a new thread's global engine. Seeds are distinct for every
+	/// thread: the thread's id is combined with a process-wide sequence number, so ids reused by
+	/// later threads still get new seeds, and the result is mixed with SplitMix64
+	///
+	/// @return - The seed
+	[[nodiscard]] inline auto make_thread_seed() noexcept -> size_t {
+		static std::atomic<std::uint64_t> sequence = 0U;
+		const auto sequenceNumber = sequence.fetch_add(1U, std::memory_order_relaxed);
+		const auto threadHash = std::hash<std::thread::id>()(std::this_thread::get_id());
+		const auto sequenceHash = sequenceNumber * 0x9E3779B97F4A7C15ULL;
+		auto mixer = SplitMix64Engine(narrow_cast<size_t>(threadHash)
+									  ^ narrow_cast<size_t>(sequenceHash));
+		return narrow_cast<size_t>(mixer.generate());
+	}
 
-	template<utils::concepts::Numeric T = float>
-	inline static constexpr auto initialize_global_uniform_distribution() noexcept -> void {
-		bool initialized = false;
-		if(GLOBAL_UNIFORM_DISTRIBUTION_INITIALIZED<T>.compare_exchange_strong(
-			   initialized,
-			   true,
-			   std::memory_order_seq_cst))
-		{
-			GLOBAL_UNIFORM_DISTRIBUTION<
-				T> = math::UniformDistribution<math::LinearCongruentialEngine<>, T>();
-		}
+	/// @brief Returns the calling thread's engine used by `random_value`. Each thread has its
+	/// own, independently seeded engine, so drawing from it never touches shared state.
+	/// Holding on to the reference avoids the thread-local lookup when drawing many values
+	///
+	/// @return - This thread's engine
+	[[nodiscard]] inline auto thread_random_engine() noexcept -> Xoshiro256PlusPlusEngine& {
+		thread_local auto engine = Xoshiro256PlusPlusEngine(make_thread_seed());
+		return engine;
 	}
 
+	/// @brief Generates a random value in `[0, 1)` from the calling thread's engine
+	///
+	/// @return - The random value
 	template<utils::concepts::FloatingPoint T = float>
 	inline auto random_value() noexcept -> T {
-		initialize_global_uniform_distribution<T>();
-		GLOBAL_UNIFORM_DISTRIBUTION<T>.set_min(narrow_cast<T>(0));
-		GLOBAL_UNIFORM_DISTRIBUTION<T>.set_max(narrow_cast<T>(1));
-
-		return GLOBAL_UNIFORM_DISTRIBUTION<T>();
+		// use as many of the high bits as fit in the mantissa, so the result is below `1`
+		constexpr auto bits = narrow_cast<unsigned>(std::min(std::numeric_limits<T>::digits, 63));
+		constexpr auto scale = narrow_cast<T>(1) / narrow_cast<T>(1ULL << bits);
+		return narrow_cast<T>(thread_random_engine()() >> (64U - bits)) * scale;
 	}
 
+	/// @brief Generates a random value in `[min, max)` from the calling thread's engine.
+	/// Integers are drawn without bias, each value in the range being equally likely
+	///
+	/// @param min - The minimum value to generate
+	/// @param max - The maximum value to generate
+	///
+	/// @return - The random value
 	template<utils::concepts::Numeric T = float>
 	inline auto random_value(T min, T max) noexcept -> T {
-		initialize_global_uniform_distribution<T>();
-
-		GLOBAL_UNIFORM_DISTRIBUTION<T>.set_min(min);
-		GLOBAL_UNIFORM_DISTRIBUTION<T>.set_max(max);
-
-		return GLOBAL_UNIFORM_DISTRIBUTION<T>();
+		if constexpr(utils::concepts::FloatingPoint<T>) {
+			return random_value<T>() * (max - min) + min;
+		}
+		else {
+			// Lemire's multiply-shift: the high half of `value * range` is uniform in
+			// `[0, range)` once the low halves that would make some results more likely than
+			// others are rejected
+			const auto range = narrow_cast<std::uint64_t>(max) - narrow_cast<std::uint64_t>(min);
+			auto& engine = thread_random_engine();
+			auto value = engine();
+			auto low = value * range;
+			if(low < range) {
+				const auto threshold = (0U - range) % range;
+				while(low < threshold) {
+					value = engine();
+					low = value * range;
+				}
+			}
+			const auto offset = UInt128::multiply_high(value, range);
+			return narrow_cast<T>(narrow_cast<std::uint64_t>(min) + offset);
+		}
 	}
 } // namespace hyperion::math
@@ -1,13 +1,32 @@
 #pragma once
 
+#include <bit>
+#include <cstdint>
+#include <span>
+
 #include "Constants.h"
 #include "General.h"
 #include "HyperionUtils/Concepts.h"
 
 namespace hyperion::math {
+#ifndef _MSC_VER
+	using std::int32_t;
+	using std::size_t;
+	using std::uint32_t;
+	using std::uint64_t;
+#endif //_MSC_VER
 
 	using utils::concepts::FloatingPoint;
 
+	/// @brief The sine and cosine of an angle, as calculated by `Trig::sincos`
+	///
+	/// @tparam T - The floating point type of the values
+	template<FloatingPoint T>
+	struct SinCos {
+		T sin;
+		T cos;
+	};
+
 	/// @brief Collection of approximations of various Trigonometric functions
 	class Trig {
 	  public:
@@ -53,6 +72,144 @@ namespace hyperion::math {
 			}
 		}
 
+		/// @brief Fast approximation calculation of both sine(angle) and cosine(angle)
+		///
+		/// Performs a single range reduction shared by both approximations, so this is cheaper
+		/// than calling `sin` and `cos` separately
+		///
+		/// @param angle - The angle to calculate the sine and cosine of
+		/// @return - The sine and cosine of the angle
+		[[nodiscard]] static constexpr inline auto
+		sincos(FloatingPoint auto angle) noexcept -> SinCos<decltype(angle)> {
+			if constexpr(std::is_same_v<decltype(angle), float>) {
+				return sincosf_internal(angle);
+			}
+			else {
+				return sincos_internal(angle);
+			}
+		}
+
+		/// @brief Fast approximation calculation of cosine(angle) for each angle in `angles`
+		/// @note Only the first `min(angles.size(), out.size())` elements are processed
+		///
+		/// The batch kernels perform branch-free range reduction, so the loop is vectorized with
+		/// whichever SIMD instruction set (SSE2, AVX2, AVX-512) the target is compiled for
+		///
+		/// @param angles - The angles to calculate the cosine of
+		/// @param out - The span to store the cosines in
+		static constexpr inline auto
+		cos(std::span<const float> angles, std::span<float> out) noexcept -> void {
+			const auto size = General::min(angles.size(), out.size());
+			for(size_t i = 0; i < size; ++i) {
+				out[i] = cosf_batch_kernel(angles[i]);
+			}
+		}
+
+		/// @brief Fast approximation calculation of cosine(angle) for each angle in `angles`
+		/// @note Only the first `min(angles.size(), out.size())` elements are processed
+		///
+		/// @param angles - The angles to calculate the cosine of
+		/// @param out - The span to store the cosines in
+		static constexpr inline auto
+		cos(std::span<const double> angles, std::span<double> out) noexcept -> void {
+			const auto size = General::min(angles.size(), out.size());
+			for(size_t i = 0; i < size; ++i) {
+				out[i] = cos_batch_kernel(angles[i]);
+			}
+		}
+
+		/// @brief Fast approximation calculation of sine(angle) for each angle in `angles`
+		/// @note Only the first `min(angles.size(), out.size())` elements are processed
+		///
+		/// @param angles - The angles to calculate the sine of
+		/// @param out - The span to store the sines in
+		static constexpr inline auto
+		sin(std::span<const float> angles, std::span<float> out) noexcept -> void {
+			const auto size = General::min(angles.size(), out.size());
+			for(size_t i = 0; i < size; ++i) {
+				out[i] = sinf_batch_kernel(angles[i]);
+			}
+		}
+
+		/// @brief Fast approximation calculation of sine(angle) for each angle in `angles`
+		/// @note Only the first `min(angles.size(), out.size())` elements are processed
+		///
+		/// @param angles - The angles to calculate the sine of
+		/// @param out - The span to store the sines in
+		static constexpr inline auto
+		sin(std::span<const double> angles, std::span<double> out) noexcept -> void {
+			const auto size = General::min(angles.size(), out.size());
+			for(size_t i = 0; i < size; ++i) {
+				out[i] = sin_batch_kernel(angles[i]);
+			}
+		}
+
+		/// @brief Fast approximation calculation of tangent(angle) for each angle in `angles`
+		/// @note Only the first `min(angles.size(), out.size())` elements are processed
+		///
+		/// @param angles - The angles to calculate the tangent of
+		/// @param out - The span to store the tangents in
+		static constexpr inline auto
+		tan(std::span<const float> angles, std::span<float> out) noexcept -> void {
+			const auto size = General::min(angles.size(), out.size());
+			for(size_t i = 0; i < size; ++i) {
+				out[i] = tanf_batch_kernel(angles[i]);
+			}
+		}
+
+		/// @brief Fast approximation calculation of tangent(angle) for each angle in `angles`
+		/// @note Only the first `min(angles.size(), out.size())` elements are processed
+		///
+		/// @param angles - The angles to calculate the tangent of
+		/// @param out - The span to store the tangents in
+		static constexpr inline auto
+		tan(std::span<const double> angles, std::span<double> out) noexcept -> void {
+			const auto size = General::min(angles.size(), out.size());
+			for(size_t i = 0; i < size; ++i) {
+				out[i] = tan_batch_kernel(angles[i]);
+			}
+		}
+
+		/// @brief Fast approximation calculation of both sine(angle) and cosine(angle) for each
+		/// angle in `angles`
+		/// @note Only the first `min(angles.size(), sines.size(), cosines.size())` elements are
+		/// processed
+		///
+		/// @param angles - The angles to calculate the sine and cosine of
+		/// @param sines - The span to store the sines in
+		/// @param cosines - The span to store the cosines in
+		static constexpr inline auto sincos(std::span<const float> angles,
+											std::span<float> sines,
+											std::span<float> cosines) noexcept -> void {
+			const auto size
+				= General::min(angles.size(), General::min(sines.size(), cosines.size()));
+			for(size_t i = 0; i < size; ++i) {
+				const auto result = sincosf_internal(angles[i]);
+				sines[i] = result.sin;
+				cosines[i] = result.cos;
+			}
+		}
+
+		/// @brief Fast approximation calculation of both sine(angle) and cosine(angle) for each
+		/// angle in `angles`
+		/// @note Only the first `min(angles.size(), sines.size(), cosines.size())` elements are
+		/// processed
+		///
+		/// @param angles - The angles to calculate the sine and cosine of
+		/// @param sines - The span to store the sines in
+		/// @param cosines - The span to store the cosines in
+		static constexpr inline auto sincos(std::span<const double> angles,
+											std::span<double> sines,
+											std::span<double> cosines) noexcept -> void {
+			const auto size
+				= General::min(angles.size(), General::min(sines.size(), cosines.size()));
+			for(size_t i = 0; i < size; ++i) {
+				const auto result = sincos_internal(angles[i]);
+				sines[i] = result.sin;
+				cosines[i] = result.cos;
+			}
+		}
+
 		/// @brief Fast approximation calculation of arctangent(angle)
 		///
 		/// @param angle - The angle to calculate the arctangent of
@@ -87,6 +244,14 @@ namespace hyperion::math {
 		/// @param x - the angle
 		/// @return - cos(x)
 		[[nodiscard]] static constexpr inline auto cos_helperf(float x) noexcept -> float {
+			return cos_polynomialf(x * x);
+		}
+
+		/// @brief Helper function for `cosf` and `sincosf`; Don't use on its own
+		///
+		/// @param x2 - the angle, squared
+		/// @return - cos(x)
+		[[nodiscard]] static constexpr inline auto cos_polynomialf(float x2) noexcept -> float {
 			constexpr float c1 = 0.99999999999925182F;
 			constexpr float c2 = -0.49999999997024012F;
 			constexpr float c3 = 0.041666666473384543F;
@@ -95,11 +260,25 @@ namespace hyperion::math {
 			constexpr float c6 = -0.0000002752469638432F;
 			constexpr float c7 = 0.0000000019907856854F;
 
-			const auto x2 = x * x; // The input argument squared
-
 			return (c1 + x2 * (c2 + x2 * (c3 + x2 * (c4 + x2 * (c5 + x2 * (c6 + c7 * x2))))));
 		}
 
+		/// @brief Helper function for `sincosf`; Don't use on its own
+		/// This is the Taylor series of sin(x) / x, accurate in [-pi/2, pi/2]
+		///
+		/// @param x2 - the angle, squared
+		/// @return - sin(x) / x
+		[[nodiscard]] static constexpr inline auto sin_polynomialf(float x2) noexcept -> float {
+			constexpr float c1 = 1.0F;
+			constexpr float c2 = -1.0F / 6.0F;
+			constexpr float c3 = 1.0F / 120.0F;
+			constexpr float c4 = -1.0F / 5040.0F;
+			constexpr float c5 = 1.0F / 362880.0F;
+			constexpr float c6 = -1.0F / 39916800.0F;
+
+			return (c1 + x2 * (c2 + x2 * (c3 + x2 * (c4 + x2 * (c5 + x2 * c6)))));
+		}
+
 		/// @brief Fast approximation calculation of cosine(angle)
 		///
 		/// @param angle - The angle to calculate the cosine of
@@ -184,6 +363,147 @@ namespace hyperion::math {
 			}
 		}
 
+		/// @brief Rounds `x` to the nearest integer without branching; Don't use on its own
+		///
+		/// @param x - The value to round
+		/// @return - The nearest integer to `x`
+		[[nodiscard]] static constexpr inline auto nearest_integerf(float x) noexcept -> int32_t {
+			return static_cast<int32_t>(x + (x < 0.0F ? -0.5F : 0.5F));
+		}
+
+		/// @brief Clamps `angle` to [-2^23, 2^23] without branching; Don't use on its own
+		///
+		/// Keeps the number of half turns in range of `int32_t`, and the reduction's error small
+		/// enough that the result stays in [-pi/2, pi/2]. Floats that large have no fractional
+		/// bits, so larger angles are reduced as if they were +/-2^23: their results are defined,
+		/// but not accurate
+		///
+		/// @param angle - The angle to clamp
+		/// @return - The clamped angle
+		[[nodiscard]] static constexpr inline auto clamp_anglef(float angle) noexcept -> float {
+			constexpr auto limit = std::bit_cast<uint32_t>(8388608.0F);
+
+			// clamp the magnitude as an integer: a floating point comparison would keep the
+			// kernels from vectorizing unless floating point exceptions are disabled
+			const auto bits = std::bit_cast<uint32_t>(angle);
+			const auto magnitude = bits & 0x7fffffffU;
+			const auto clamped = magnitude > limit ? limit : magnitude;
+			return std::bit_cast<float>((bits & 0x80000000U) | clamped);
+		}
+
+		/// @brief Returns NaN in place of `result` if `angle` is NaN or infinite, without
+		/// branching; Don't use on its own
+		///
+		/// `clamp_anglef` turns non-finite angles into finite ones, so the kernels restore the
+		/// NaN they should produce for those afterwards
+		///
+		/// @param result - The result calculated from the clamped angle
+		/// @param angle - The angle before clamping
+		/// @return - `result`, or NaN
+		[[nodiscard]] static constexpr inline auto
+		nan_if_not_finitef(float result, float angle) noexcept -> float {
+			const auto nonFinite = (std::bit_cast<uint32_t>(angle) & 0x7fffffffU) >= 0x7f800000U;
+			// setting the exponent and the quiet bit turns any value into a NaN
+			return std::bit_cast<float>(std::bit_cast<uint32_t>(result)
+										| (nonFinite ? 0x7fc00000U : 0U));
+		}
+
+		/// @brief Branch-free range reduction for the batch kernels; Don't use on its own
+		///
+		/// Calculates `angle - halfTurns * pi`, with pi split in three parts (Cody-Waite).
+		/// The first two parts have 8 and 11 significant bits, so their products are exact while
+		/// `halfTurns` has at most 13 significant bits: |angle| up to about 25,000, or 12,000 for
+		/// the sine kernel's half-integer counts. Past that the products round, and accuracy
+		/// degrades as the angle grows
+		///
+		/// @param angle - The angle to reduce
+		/// @param halfTurns - The number of multiples of pi to remove from `angle`
+		/// @return - The reduced angle
+		[[nodiscard]] static constexpr inline auto
+		reduce_half_turnsf(float angle, float halfTurns) noexcept -> float {
+			constexpr float pi1 = 3.140625F;
+			constexpr float pi2 = 9.67502593994140625e-4F;
+			constexpr float pi3 = 1.509957990978376432e-7F;
+
+			return ((angle - halfTurns * pi1) - halfTurns * pi2) - halfTurns * pi3;
+		}
+
+		/// @brief Negates `x` if `halfTurns` is odd, without branching; Don't use on its own
+		///
+		/// @param x - The value to conditionally negate
+		/// @param halfTurns - The number of half turns the value was reduced by
+		/// @return - `x` or `-x`
+		[[nodiscard]] static constexpr inline auto
+		negate_if_oddf(float x, int32_t halfTurns) noexcept -> float {
+			return std::bit_cast<float>(std::bit_cast<uint32_t>(x)
+										^ (static_cast<uint32_t>(halfTurns) << 31U));
+		}
+
+		/// @brief Branch-free cosine kernel used by the batch overloads; Don't use on its own
+		///
+		/// @param angle - The angle to calculate the cosine of
+		/// @return - The cosine of the angle
+		[[nodiscard]] static constexpr inline auto
+		cosf_batch_kernel(float angle) noexcept -> float {
+			const auto clamped = clamp_anglef(angle);
+			// angle = halfTurns * pi + r, r in [-pi/2, pi/2],
+			// so cos(angle) = (-1)^halfTurns * cos(r)
+			const auto halfTurns = nearest_integerf(clamped * Constants<float>::oneOverPi);
+			const auto r = reduce_half_turnsf(clamped, static_cast<float>(halfTurns));
+			return nan_if_not_finitef(negate_if_oddf(cos_helperf(r), halfTurns), angle);
+		}
+
+		/// @brief Branch-free sine kernel used by the batch overloads; Don't use on its own
+		///
+		/// @param angle - The angle to calculate the sine of
+		/// @return - The sine of the angle
+		[[nodiscard]] static constexpr inline auto
+		sinf_batch_kernel(float angle) noexcept -> float {
+			const auto clamped = clamp_anglef(angle);
+			// angle = (halfTurns + 1/2) * pi + r, r in [-pi/2, pi/2],
+			// so sin(angle) = (-1)^halfTurns * cos(r)
+			const auto halfTurns
+				= nearest_integerf(clamped * Constants<float>::oneOverPi - 0.5F);
+			const auto r = reduce_half_turnsf(clamped, static_cast<float>(halfTurns) + 0.5F);
+			return nan_if_not_finitef(negate_if_oddf(cos_helperf(r), halfTurns), angle);
+		}
+
+		/// @brief Branch-free tangent kernel used by the batch overloads; Don't use on its own
+		///
+		/// @param angle - The angle to calculate the tangent of
+		/// @return - The tangent of the angle
+		[[nodiscard]] static constexpr inline auto
+		tanf_batch_kernel(float angle) noexcept -> float {
+			const auto clamped = clamp_anglef(angle);
+			// tan has period pi, so reduce to r in [-pi/2, pi/2]
+			const auto halfTurns = nearest_integerf(clamped * Constants<float>::oneOverPi);
+			const auto r = reduce_half_turnsf(clamped, static_cast<float>(halfTurns));
+			const auto absR = r < 0.0F ? -r : r;
+			// tan(x) = 1 / tan(pi/2 - x), so reduce to [0, pi/4], the helper's accurate range
+			const auto complement = absR > Constants<float>::piOver4;
+			const auto reduced = complement ? Constants<float>::piOver2 - absR : absR;
+			const auto approx = tan_helperf(reduced * Constants<float>::fourOverPi);
+			const auto y = complement ? 1.0F / approx : approx;
+			return nan_if_not_finitef(r < 0.0F ? -y : y, angle);
+		}
+
+		/// @brief Fast approximation calculation of both sine(angle) and cosine(angle)
+		///
+		/// @param angle - The angle to calculate the sine and cosine of
+		/// @return - The sine and cosine of the angle
+		[[nodiscard]] static constexpr inline auto
+		sincosf_internal(float angle) noexcept -> SinCos<float> {
+			const auto clamped = clamp_anglef(angle);
+			// angle = halfTurns * pi + r, r in [-pi/2, pi/2],
+			// so sin(angle) = (-1)^halfTurns * sin(r) and cos(angle) = (-1)^halfTurns * cos(r)
+			const auto halfTurns = nearest_integerf(clamped * Constants<float>::oneOverPi);
+			const auto r = reduce_half_turnsf(clamped, static_cast<float>(halfTurns));
+			const auto r2 = r * r;
+			const auto sine = negate_if_oddf(r * sin_polynomialf(r2), halfTurns);
+			const auto cosine = negate_if_oddf(cos_polynomialf(r2), halfTurns);
+			return {nan_if_not_finitef(sine, angle), nan_if_not_finitef(cosine, angle)};
+		}
+
 		/// @brief Helper function for `atanf`; Don't use on its own
 		///
 		/// @param x - the angle
@@ -272,6 +592,14 @@ namespace hyperion::math {
 		/// @param x - The angle
 		/// @return cos(x)
 		[[nodiscard]] static constexpr inline auto cos_helper(double x) noexcept -> double {
+			return cos_polynomial(x * x);
+		}
+
+		/// @brief Helper function for `cos` and `sincos`; Don't use on its own
+		///
+		/// @param x2 - The angle, squared
+		/// @return cos(x)
+		[[nodiscard]] static constexpr inline auto cos_polynomial(double x2) noexcept -> double {
 			constexpr double c1 = 0.99999999999925182;
 			constexpr double c2 = -0.49999999997024012;
 			constexpr double c3 = 0.041666666473384543;
@@ -280,11 +608,29 @@ namespace hyperion::math {
 			constexpr double c6 = -0.0000002752469638432;
 			constexpr double c7 = 0.0000000019907856854;
 
-			const double x2 = x * x; // The input argument squared
-
 			return (c1 + x2 * (c2 + x2 * (c3 + x2 * (c4 + x2 * (c5 + x2 * (c6 + c7 * x2))))));
 		}
 
+		/// @brief Helper function for `sincos`; Don't use on its own
+		/// This is the Taylor series of sin(x) / x, accurate in [-pi/2, pi/2]
+		///
+		/// @param x2 - The angle, squared
+		/// @return sin(x) / x
+		[[nodiscard]] static constexpr inline auto sin_polynomial(double x2) noexcept -> double {
+			constexpr double c1 = 1.0;
+			constexpr double c2 = -1.0 / 6.0;
+			constexpr double c3 = 1.0 / 120.0;
+			constexpr double c4 = -1.0 / 5040.0;
+			constexpr double c5 = 1.0 / 362880.0;
+			constexpr double c6 = -1.0 / 39916800.0;
+			constexpr double c7 = 1.0 / 6227020800.0;
+			constexpr double c8 = -1.0 / 1307674368000.0;
+			constexpr double c9 = 1.0 / 355687428096000.0;
+
+			const auto highOrderTerms = c5 + x2 * (c6 + x2 * (c7 + x2 * (c8 + x2 * c9)));
+			return (c1 + x2 * (c2 + x2 * (c3 + x2 * (c4 + x2 * highOrderTerms))));
+		}
+
 		/// @brief Fast approximation calculation of cosine(angle)
 		///
 		/// @param angle - The angle to calculate the cosine of
@@ -369,6 +715,146 @@ namespace hyperion::math {
 			}
 		}
 
+		/// @brief Rounds `x` to the nearest integer without branching; Don't use on its own
+		///
+		/// @param x - The value to round
+		/// @return - The nearest integer to `x`
+		[[nodiscard]] static constexpr inline auto nearest_integer(double x) noexcept -> int32_t {
+			return static_cast<int32_t>(x + (x < 0.0 ? -0.5 : 0.5));
+		}
+
+		/// @brief Clamps `angle` to [-2^31, 2^31] without branching, so the number of half turns
+		/// in it always fits in an `int32_t`; Don't use on its own
+		///
+		/// Larger angles are reduced as if they were +/-2^31, so their results are defined but not
+		/// accurate
+		///
+		/// @param angle - The angle to clamp
+		/// @return - The clamped angle
+		[[nodiscard]] static constexpr inline auto clamp_angle(double angle) noexcept -> double {
+			constexpr auto limit = std::bit_cast<uint64_t>(2147483648.0);
+
+			// clamp the magnitude as an integer: a floating point comparison would keep the
+			// kernels from vectorizing unless floating point exceptions are disabled
+			const auto bits = std::bit_cast<uint64_t>(angle);
+			const auto magnitude = bits & 0x7fffffffffffffffULL;
+			const auto clamped = magnitude > limit ? limit : magnitude;
+			return std::bit_cast<double>((bits & 0x8000000000000000ULL) | clamped);
+		}
+
+		/// @brief Returns NaN in place of `result` if `angle` is NaN or infinite, without
+		/// branching; Don't use on its own
+		///
+		/// `clamp_angle` turns non-finite angles into finite ones, so the kernels restore the NaN
+		/// they should produce for those afterwards
+		///
+		/// @param result - The result calculated from the clamped angle
+		/// @param angle - The angle before clamping
+		/// @return - `result`, or NaN
+		[[nodiscard]] static constexpr inline auto
+		nan_if_not_finite(double result, double angle) noexcept -> double {
+			const auto nonFinite = (std::bit_cast<uint64_t>(angle) & 0x7fffffffffffffffULL)
+								   >= 0x7ff0000000000000ULL;
+			// setting the exponent and the quiet bit turns any value into a NaN
+			return std::bit_cast<double>(std::bit_cast<uint64_t>(result)
+										 | (nonFinite ? 0x7ff8000000000000ULL : 0ULL));
+		}
+
+		/// @brief Branch-free range reduction for the batch kernels; Don't use on its own
+		///
+		/// Calculates `angle - halfTurns * pi`, with pi split in three parts (Cody-Waite).
+		/// The first two parts have 23 and 21 significant bits, so their products are exact while
+		/// `halfTurns` has at most 30 significant bits: the whole clamped range for cosine and
+		/// tangent, and |angle| up to about 1.7e9 for the sine kernel's half-integer counts
+		///
+		/// @param angle - The angle to reduce
+		/// @param halfTurns - The number of multiples of pi to remove from `angle`
+		/// @return - The reduced angle
+		[[nodiscard]] static constexpr inline auto
+		reduce_half_turns(double angle, double halfTurns) noexcept -> double {
+			constexpr double pi1 = 3.14159250259399414062;
+			constexpr double pi2 = 1.50995788317231926667e-7;
+			constexpr double pi3 = 1.07806057163162381058e-14;
+
+			return ((angle - halfTurns * pi1) - halfTurns * pi2) - halfTurns * pi3;
+		}
+
+		/// @brief Negates `x` if `halfTurns` is odd, without branching; Don't use on its own
+		///
+		/// @param x - The value to conditionally negate
+		/// @param halfTurns - The number of half turns the value was reduced by
+		/// @return - `x` or `-x`
+		[[nodiscard]] static constexpr inline auto
+		negate_if_odd(double x, int32_t halfTurns) noexcept -> double {
+			return std::bit_cast<double>(
+				std::bit_cast<uint64_t>(x)
+				^ (static_cast<uint64_t>(static_cast<uint32_t>(halfTurns)) << 63U));
+		}
+
+		/// @brief Branch-free cosine kernel used by the batch overloads; Don't use on its own
+		///
+		/// @param angle - The angle to calculate the cosine of
+		/// @return - The cosine of the angle
+		[[nodiscard]] static constexpr inline auto
+		cos_batch_kernel(double angle) noexcept -> double {
+			const auto clamped = clamp_angle(angle);
+			// angle = halfTurns * pi + r, r in [-pi/2, pi/2],
+			// so cos(angle) = (-1)^halfTurns * cos(r)
+			const auto halfTurns = nearest_integer(clamped * Constants<double>::oneOverPi);
+			const auto r = reduce_half_turns(clamped, static_cast<double>(halfTurns));
+			return nan_if_not_finite(negate_if_odd(cos_helper(r), halfTurns), angle);
+		}
+
+		/// @brief Branch-free sine kernel used by the batch overloads; Don't use on its own
+		///
+		/// @param angle - The angle to calculate the sine of
+		/// @return - The sine of the angle
+		[[nodiscard]] static constexpr inline auto
+		sin_batch_kernel(double angle) noexcept -> double {
+			const auto clamped = clamp_angle(angle);
+			// angle = (halfTurns + 1/2) * pi + r, r in [-pi/2, pi/2],
+			// so sin(angle) = (-1)^halfTurns * cos(r)
+			const auto halfTurns = nearest_integer(clamped * Constants<double>::oneOverPi - 0.5);
+			const auto r = reduce_half_turns(clamped, static_cast<double>(halfTurns) + 0.5);
+			return nan_if_not_finite(negate_if_odd(cos_helper(r), halfTurns), angle);
+		}
+
+		/// @brief Branch-free tangent kernel used by the batch overloads; Don't use on its own
+		///
+		/// @param angle - The angle to calculate the tangent of
+		/// @return - The tangent of the angle
+		[[nodiscard]] static constexpr inline auto
+		tan_batch_kernel(double angle) noexcept -> double {
+			const auto clamped = clamp_angle(angle);
+			// tan has period pi, so reduce to r in [-pi/2, pi/2]
+			const auto halfTurns = nearest_integer(clamped * Constants<double>::oneOverPi);
+			const auto r = reduce_half_turns(clamped, static_cast<double>(halfTurns));
+			const auto absR = r < 0.0 ? -r : r;
+			// tan(x) = 1 / tan(pi/2 - x), so reduce to [0, pi/4], the helper's accurate range
+			const auto complement = absR > Constants<double>::piOver4;
+			const auto reduced = complement ? Constants<double>::piOver2 - absR : absR;
+			const auto approx = tan_helper(reduced * Constants<double>::fourOverPi);
+			const auto y = complement ? 1.0 / approx : approx;
+			return nan_if_not_finite(r < 0.0 ? -y : y, angle);
+		}
+
+		/// @brief Fast approximation calculation of both sine(angle) and cosine(angle)
+		///
+		/// @param angle - The angle to calculate the sine and cosine of
+		/// @return - The sine and cosine of the angle
+		[[nodiscard]] static constexpr inline auto
+		sincos_internal(double angle) noexcept -> SinCos<double> {
+			const auto clamped = clamp_angle(angle);
+			// angle = halfTurns * pi + r, r in [-pi/2, pi/2],
+			// so sin(angle) = (-1)^halfTurns * sin(r) and cos(angle) = (-1)^halfTurns * cos(r)
+			const auto halfTurns = nearest_integer(clamped * Constants<double>::oneOverPi);
+			const auto r = reduce_half_turns(clamped, static_cast<double>(halfTurns));
+			const auto r2 = r * r;
+			const auto sine = negate_if_odd(r * sin_polynomial(r2), halfTurns);
+			const auto cosine = negate_if_odd(cos_polynomial(r2), halfTurns);
+			return {nan_if_not_finite(sine, angle), nan_if_not_finite(cosine, angle)};
+		}
+
 		/// @brief Helper function for `atanf`; Don't use on its own
 		///
 		/// @param x - the angle
@@ -152,6 +152,18 @@ namespace hyperion::math {
 			return std::move(*this / magnitude<TT>());
 		}
 
+		/// @brief Returns this vector with normalized magnitude, using the fast reciprocal
+		/// square root approximation instead of a square root and a division
+		///
+		/// @tparam Iterations - The number of Newton steps to refine the reciprocal square root
+		/// with. See `General::rsqrt`
+		/// @return this vector, normalized
+		template<FloatingPoint TT = float,
+				 size_t Iterations = General::RSQRT_DEFAULT_ITERATIONS<TT>>
+		[[nodiscard]] inline constexpr auto normalized_fast() const noexcept -> Vec3<TT> {
+			return *this * General::rsqrt<Iterations>(narrow_cast<TT>(magnitude_squared()));
+		}
+
 		template<SignedNumeric TT = float>
 		[[nodiscard]] inline static constexpr auto random() noexcept -> Vec3<TT> {
 			return {random_value<TT>(), random_value<TT>(), random_value<TT>()};
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <gtest/gtest.h>
+
+#include "HyperionMath/Automation.h"
+#include "HyperionMath/Interpolator.h"
+
+namespace hyperion::math::test {
+
+	TEST(AutomationTest, holdsInitialValue) {
+		auto automation = BreakpointAutomation<float>(0.5F, 100ULL);
+		auto block = std::array<float, 32>();
+
+		automation.process(block, {});
+		for(const auto value : block) {
+			ASSERT_FLOAT_EQ(0.5F, value);
+		}
+	}
+
+	TEST(AutomationTest, eventsAreSampleAccurate) {
+		using Event = BreakpointAutomation<float>::Event;
+		auto automation = BreakpointAutomation<float>(0.0F, 100ULL);
+		auto block = std::array<float, 32>();
+		// ramp to 1 over 10 samples starting at sample 5, then back to 0 from sample 20
+		const auto events = std::array<Event, 2>{
+			Event{5ULL, 1.0F, InterpolationType::Linear, 0.1F},
+			Event{20ULL, 0.0F, InterpolationType::Linear, 0.1F},
+		};
+
+		automation.process(block, events);
+		ASSERT_FLOAT_EQ(0.0F, block[4]);
+		ASSERT_FLOAT_EQ(0.0F, block[5]);
+		ASSERT_FLOAT_EQ(0.5F, block[10]);
+		ASSERT_FLOAT_EQ(1.0F, block[15]);
+		ASSERT_FLOAT_EQ(1.0F, block[20]);
+		ASSERT_FLOAT_EQ(0.5F, block[25]);
+		ASSERT_NEAR(0.0F, block[30], 1e-6F); // NOLINT
+	}
+
+	TEST(AutomationTest, segmentsSpanBlocks) {
+		using Event = BreakpointAutomation<double>::Event;
+		auto automation = BreakpointAutomation<double>(0.0, 100ULL);
+		auto reference
+			= Interpolator<double, InterpolationType::Exponential>(2.0, 0.0, 0.5, 100ULL);
+		auto block = std::array<double, 16>();
+		const auto events = std::array<Event, 1>{
+			Event{0ULL, 2.0, InterpolationType::Exponential, 0.5},
+		};
+
+		automation.process(block, events);
+		for(const auto value : block) {
+			ASSERT_DOUBLE_EQ(reference.get_next_value(), value);
+		}
+		for(auto i = 0; i < 4; ++i) {
+			automation.process(block, {});
+			for(const auto value : block) {
+				ASSERT_DOUBLE_EQ(reference.get_next_value(), value);
+			}
+		}
+	}
+
+	TEST(AutomationTest, apply) {
+		using Event = BreakpointAutomation<float>::Event;
+		auto automation = BreakpointAutomation<float>(1.0F, 100ULL);
+		auto block = std::array<float, 32>();
+		block.fill(2.0F);
+		const auto events = std::array<Event, 1>{
+			Event{8ULL, 0.0F, InterpolationType::Linear, 0.1F},
+		};
+
+		automation.apply(block, events);
+		ASSERT_FLOAT_EQ(2.0F, block[0]);
+		ASSERT_FLOAT_EQ(1.0F, block[13]);
+		ASSERT_NEAR(0.0F, block[18], 1e-6F); // NOLINT
+		ASSERT_NEAR(0.0F, block[31], 1e-6F); // NOLINT
+		ASSERT_NEAR(0.0F, automation.get_current_value(), 1e-6F); // NOLINT
+	}
+
+	TEST(AutomationTest, reportsConstantBlocks) {
+		using Event = BreakpointAutomation<float>::Event;
+		auto automation = BreakpointAutomation<float>(0.5F, 100ULL);
+		auto block = std::array<float, 32>();
+		const auto events = std::array<Event, 1>{
+			Event{31ULL, 1.0F, InterpolationType::Linear, 0.1F},
+		};
+
+		ASSERT_FALSE(automation.process(block, {}));
+		ASSERT_TRUE(automation.is_settled());
+		ASSERT_TRUE(automation.process(block, {}));
+		ASSERT_FALSE(automation.process(block, events));
+		ASSERT_FALSE(automation.is_settled());
+	}
+} // namespace hyperion::math::test
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "HyperionMath/ConcurrentInterpolator.h"
+#include "HyperionMath/Interpolator.h"
+
+namespace hyperion::math::test {
+
+	TEST(ConcurrentInterpolatorTest, appliesTargetAtBlockStart) {
+		auto interp = ConcurrentInterpolator<float, InterpolationType::Linear>(1.0F,
+																			   1.0F,
+																			   1.0F,
+																			   10ULL);
+		auto block = std::array<float, 16>();
+
+		interp.process(block);
+		ASSERT_FLOAT_EQ(1.0F, block.back());
+
+		interp.set_target(0.5F);
+		// a new target is only picked up at the start of a block
+		ASSERT_FLOAT_EQ(1.0F, interp.get_next_value());
+		interp.process(block);
+		ASSERT_FLOAT_EQ(1.0F, block.front());
+		ASSERT_FLOAT_EQ(0.75F, block[5]);
+		ASSERT_FLOAT_EQ(0.5F, block.back());
+	}
+
+	TEST(ConcurrentInterpolatorTest, unchangedTargetIsIgnored) {
+		auto interp = ConcurrentInterpolator<float, InterpolationType::Linear>(1.0F,
+																			   0.0F,
+																			   1.0F,
+																			   10ULL);
+		ASSERT_FALSE(interp.apply_pending_target());
+		interp.set_target(0.25F);
+		ASSERT_TRUE(interp.apply_pending_target());
+		interp.set_target(0.25F);
+		ASSERT_FALSE(interp.apply_pending_target());
+	}
+
+	TEST(ConcurrentInterpolatorTest, crossThreadTargets) {
+		// a transition lasts exactly one block
+		auto interp = ConcurrentInterpolator<double, InterpolationType::Linear>(0.0,
+																				0.0,
+																				0.0625,
+																				1024ULL);
+		auto done = std::atomic_bool(false);
+		auto producer = std::thread([&]() {
+			for(auto i = 0; i <= 10000; ++i) {
+				interp.set_target(static_cast<double>(i % 2));
+			}
+			interp.set_target(0.75);
+			done.store(true);
+		});
+
+		auto block = std::array<double, 64>();
+		while(!done.load()) {
+			interp.process(block);
+			for(const auto value : block) {
+				ASSERT_GE(value, 0.0);
+				ASSERT_LE(value, 1.0);
+			}
+		}
+		producer.join();
+
+		// the final target is picked up by the next block, and reached once its transition ends
+		for(auto i = 0; i < 2; ++i) {
+			interp.process(block);
+		}
+		ASSERT_DOUBLE_EQ(0.75, block.back());
+	}
+
+	TEST(ConcurrentInterpolatorTest, reportsConstantBlocks) {
+		auto interp = ConcurrentInterpolator<float, InterpolationType::Linear>(1.0F,
+																			   0.0F,
+																			   0.1F,
+																			   100ULL);
+		auto block = std::array<float, 16>();
+
+		ASSERT_FALSE(interp.process(block));
+		ASSERT_TRUE(interp.is_settled());
+		ASSERT_TRUE(interp.process(block));
+
+		// a pending target isn't reported until it's applied
+		interp.set_target(0.5F);
+		ASSERT_TRUE(interp.is_settled());
+		ASSERT_FALSE(interp.process(block));
+		ASSERT_EQ(0ULL, interp.samples_remaining());
+		ASSERT_TRUE(interp.process(block));
+		ASSERT_FLOAT_EQ(0.5F, block.front());
+	}
+} // namespace hyperion::math::test
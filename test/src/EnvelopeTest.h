@@ -0,0 +1,161 @@
+#pragma once
+
+#include <array>
+#include <gtest/gtest.h>
+
+#include "HyperionMath/Envelope.h"
+
+namespace hyperion::math::test {
+
+	/// @brief Returns envelope parameters with linear stages a whole number of samples long at
+	/// a sample rate of 100Hz
+	inline auto linear_envelope_parameters() noexcept -> EnvelopeParameters<float> {
+		auto parameters = EnvelopeParameters<float>();
+		parameters.delaySeconds = 0.05F;
+		parameters.attackSeconds = 0.1F;
+		parameters.holdSeconds = 0.05F;
+		parameters.decaySeconds = 0.1F;
+		parameters.sustainLevel = 0.5F;
+		parameters.releaseSeconds = 0.1F;
+		parameters.attackType = InterpolationType::Linear;
+		parameters.decayType = InterpolationType::Linear;
+		parameters.releaseType = InterpolationType::Linear;
+		return parameters;
+	}
+
+	TEST(EnvelopeTest, stages) {
+		auto envelope = Envelope<float>(linear_envelope_parameters(), 100ULL);
+		auto block = std::array<float, 48>();
+		ASSERT_TRUE(envelope.process(block));
+		ASSERT_FLOAT_EQ(0.0F, block.back());
+
+		envelope.note_on();
+		ASSERT_EQ(EnvelopeStage::Delay, envelope.get_stage());
+		ASSERT_FALSE(envelope.process(block));
+		// delay: samples [0, 5)
+		ASSERT_FLOAT_EQ(0.0F, block[4]);
+		// attack: samples [5, 16)
+		ASSERT_NEAR(0.5F, block[10], 1e-6F); // NOLINT
+		ASSERT_FLOAT_EQ(1.0F, block[15]);
+		// hold: samples [16, 21)
+		ASSERT_FLOAT_EQ(1.0F, block[20]);
+		// decay: samples [21, 32)
+		ASSERT_NEAR(0.75F, block[26], 1e-6F); // NOLINT
+		ASSERT_FLOAT_EQ(0.5F, block[31]);
+		// sustain
+		ASSERT_FLOAT_EQ(0.5F, block.back());
+		ASSERT_EQ(EnvelopeStage::Sustain, envelope.get_stage());
+		ASSERT_TRUE(envelope.process(block));
+
+		envelope.note_off();
+		ASSERT_EQ(EnvelopeStage::Release, envelope.get_stage());
+		ASSERT_FALSE(envelope.process(block));
+		ASSERT_NEAR(0.25F, block[5], 1e-6F); // NOLINT
+		ASSERT_NEAR(0.0F, block[10], 1e-6F); // NOLINT
+		ASSERT_FLOAT_EQ(0.0F, block.back());
+		ASSERT_FALSE(envelope.is_active());
+	}
+
+	TEST(EnvelopeTest, logarithmicStagesLandOnTargets) {
+		// logarithmic curves stop short of their target, so the stages must finish on it
+		auto envelope = Envelope<float>(EnvelopeParameters<float>(), 100ULL);
+		auto block = std::array<float, 48>();
+		envelope.note_on();
+		envelope.process(block);
+		ASSERT_EQ(EnvelopeStage::Sustain, envelope.get_stage());
+		ASSERT_EQ(envelope.get_parameters().sustainLevel, block.back());
+
+		envelope.note_off();
+		envelope.process(block);
+		ASSERT_FALSE(envelope.is_active());
+		// release: samples [0, 21), the last of which is the target
+		ASSERT_GT(block[19], 0.0F);
+		ASSERT_EQ(0.0F, block[20]);
+	}
+
+	TEST(EnvelopeTest, zeroLengthStages) {
+		auto parameters = EnvelopeParameters<float>();
+		parameters.attackSeconds = 0.0F;
+		parameters.decaySeconds = 0.0F;
+		parameters.releaseSeconds = 0.0F;
+		auto envelope = Envelope<float>(parameters, 100ULL);
+		auto block = std::array<float, 16>();
+
+		envelope.note_on();
+		ASSERT_EQ(EnvelopeStage::Sustain, envelope.get_stage());
+		ASSERT_TRUE(envelope.process(block));
+		ASSERT_FLOAT_EQ(parameters.sustainLevel, block.front());
+
+		envelope.note_off();
+		ASSERT_FALSE(envelope.is_active());
+		ASSERT_FLOAT_EQ(0.0F, envelope.get_current_value());
+	}
+
+	TEST(EnvelopeTest, retriggerStartsFromCurrentValue) {
+		auto envelope = Envelope<float>(linear_envelope_parameters(), 100ULL);
+		auto block = std::array<float, 48>();
+		envelope.note_on();
+		envelope.process(block);
+		envelope.note_off();
+		envelope.process(std::span<float>(block).first(5));
+		const auto released = envelope.get_current_value();
+		ASSERT_NEAR(0.3F, released, 1e-6F); // NOLINT
+
+		envelope.note_on();
+		envelope.process(block);
+		// the delay holds the value the release had reached, then the attack starts from it
+		ASSERT_FLOAT_EQ(released, block[0]);
+		ASSERT_FLOAT_EQ(released, block[5]);
+		ASSERT_GT(block[6], released);
+	}
+
+	TEST(EnvelopeTest, legato) {
+		auto envelope = Envelope<float>(linear_envelope_parameters(), 100ULL);
+		auto block = std::array<float, 48>();
+		envelope.set_legato(true);
+		envelope.note_on();
+		envelope.process(block);
+
+		envelope.note_on();
+		ASSERT_EQ(EnvelopeStage::Sustain, envelope.get_stage());
+
+		envelope.set_legato(false);
+		envelope.note_on();
+		ASSERT_EQ(EnvelopeStage::Delay, envelope.get_stage());
+	}
+
+	TEST(EnvelopeTest, apply) {
+		auto parameters = linear_envelope_parameters();
+		parameters.sustainLevel = 1.0F;
+		auto envelope = Envelope<float>(parameters, 100ULL);
+		auto block = std::array<float, 48>();
+		envelope.note_on();
+		envelope.process(block);
+
+		block.fill(2.0F);
+		ASSERT_TRUE(envelope.apply(block));
+		ASSERT_FLOAT_EQ(2.0F, block.front());
+		ASSERT_FLOAT_EQ(2.0F, block.back());
+
+		envelope.note_off();
+		block.fill(2.0F);
+		ASSERT_FALSE(envelope.apply(block));
+		ASSERT_FLOAT_EQ(2.0F, block[0]);
+		ASSERT_NEAR(1.0F, block[5], 1e-6F); // NOLINT
+		ASSERT_FLOAT_EQ(0.0F, block.back());
+	}
+
+	TEST(EnvelopeTest, setSampleRateKeepsProgress) {
+		auto envelope = Envelope<float>(linear_envelope_parameters(), 100ULL);
+		auto block = std::array<float, 10>();
+		envelope.note_on();
+		envelope.process(block);
+		ASSERT_NEAR(0.4F, block.back(), 1e-6F); // NOLINT
+
+		envelope.set_sample_rate(200ULL);
+		envelope.process(block);
+		ASSERT_EQ(EnvelopeStage::Attack, envelope.get_stage());
+		ASSERT_NEAR(0.5F, block.front(), 1e-6F); // NOLINT
+		ASSERT_NEAR(0.95F, block.back(), 1e-6F); // NOLINT
+	}
+} // namespace hyperion::math::test
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <array>
+#include <cstdlib>
+#include <limits>
+#include <string>
+
 #ifndef __MSC_VER
 	#include <cmath>
 #endif
@@ -59,6 +64,16 @@ namespace hyperion::math::test {
 		ASSERT_NEAR(Exponentials::exp(input), std::exp(input), DOUBLE_ACCEPTED_ERROR);
 	}
 
+	TEST(ExponentialsTestDouble, expCase5) {
+		double input = -600.0;
+		ASSERT_NEAR(Exponentials::exp(input) / std::exp(input), 1.0, DOUBLE_ACCEPTED_ERROR);
+	}
+
+	TEST(ExponentialsTestDouble, expCase6) {
+		double input = 500.123;
+		ASSERT_NEAR(Exponentials::exp(input) / std::exp(input), 1.0, DOUBLE_ACCEPTED_ERROR);
+	}
+
 	TEST(ExponentialsTestDouble, lnCase1) {
 		double input = 1.0;
 		ASSERT_NEAR(Exponentials::ln(input), std::log(input), DOUBLE_ACCEPTED_ERROR);
@@ -89,6 +104,53 @@ namespace hyperion::math::test {
 		ASSERT_NEAR(Exponentials::log10(input), std::log10(input), DOUBLE_ACCEPTED_ERROR);
 	}
 
+	TEST(ExponentialsTestDouble, lnCase3) {
+		double input = 1.0E300;
+		ASSERT_NEAR(Exponentials::ln(input), std::log(input), DOUBLE_ACCEPTED_ERROR);
+	}
+
+	TEST(ExponentialsTestDouble, lnCase4) {
+		// subnormal
+		double input = 1.0E-310;
+		ASSERT_NEAR(Exponentials::ln(input), std::log(input), DOUBLE_ACCEPTED_ERROR);
+	}
+
+	TEST(ExponentialsTestDouble, lnSpecialCases) {
+		ASSERT_EQ(Exponentials::ln(0.0), -std::numeric_limits<double>::infinity());
+		ASSERT_TRUE(std::isnan(Exponentials::ln(-1.0)));
+		ASSERT_EQ(Exponentials::ln(std::numeric_limits<double>::infinity()),
+				  std::numeric_limits<double>::infinity());
+	}
+
+	TEST(ExponentialsTestDouble, log2Case3) {
+		double input = 1.0E300;
+		ASSERT_NEAR(Exponentials::log2(input), std::log2(input), DOUBLE_ACCEPTED_ERROR);
+	}
+
+	TEST(ExponentialsTestDouble, log10Case3) {
+		double input = 1.0E300;
+		ASSERT_NEAR(Exponentials::log10(input), std::log10(input), DOUBLE_ACCEPTED_ERROR);
+	}
+
+	TEST(ExponentialsTestDouble, logBatch) {
+		auto inputs = std::array<double, 64>();
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			inputs[i] = 0.001 + 1.5 * static_cast<double>(i * i);
+		}
+		auto lnOutputs = std::array<double, 64>();
+		auto log2Outputs = std::array<double, 64>();
+		auto log10Outputs = std::array<double, 64>();
+		Exponentials::ln(inputs, lnOutputs);
+		Exponentials::log2(inputs, log2Outputs);
+		Exponentials::log10(inputs, log10Outputs);
+
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			ASSERT_NEAR(lnOutputs[i], std::log(inputs[i]), DOUBLE_ACCEPTED_ERROR);
+			ASSERT_NEAR(log2Outputs[i], std::log2(inputs[i]), DOUBLE_ACCEPTED_ERROR);
+			ASSERT_NEAR(log10Outputs[i], std::log10(inputs[i]), DOUBLE_ACCEPTED_ERROR);
+		}
+	}
+
 	TEST(ExponentialsTestDouble, pow2Case1) {
 		double input = 1.0;
 		ASSERT_NEAR(Exponentials::pow2(input), std::pow(2.0, input), DOUBLE_ACCEPTED_ERROR);
@@ -129,6 +191,55 @@ namespace hyperion::math::test {
 		ASSERT_NEAR(Exponentials::pow10(input), std::pow(10.0, input), DOUBLE_ACCEPTED_ERROR);
 	}
 
+	TEST(ExponentialsTestDouble, pow2Case5) {
+		double input = 40.0;
+		ASSERT_DOUBLE_EQ(Exponentials::pow2(input), std::pow(2.0, input));
+	}
+
+	TEST(ExponentialsTestDouble, pow2Case6) {
+		double input = -40.0;
+		ASSERT_DOUBLE_EQ(Exponentials::pow2(input), std::pow(2.0, input));
+	}
+
+	TEST(ExponentialsTestDouble, pow10Case5) {
+		double input = 12.0;
+		ASSERT_DOUBLE_EQ(Exponentials::pow10(input), std::pow(10.0, input));
+	}
+
+	TEST(ExponentialsTestDouble, pow10Case6) {
+		double input = -12.0;
+		ASSERT_DOUBLE_EQ(Exponentials::pow10(input), std::pow(10.0, input));
+	}
+
+	TEST(ExponentialsTestDouble, pow10Case7) {
+		// integral powers must be the correctly rounded decimal value, i.e. exactly what the
+		// compiler would produce for the literal `1eN`
+		for(auto exponent = -307; exponent <= 308; ++exponent) {
+			const auto expected = std::strtod(("1e" + std::to_string(exponent)).c_str(), nullptr);
+			ASSERT_EQ(Exponentials::pow10(static_cast<double>(exponent)), expected) << exponent;
+		}
+	}
+
+	TEST(ExponentialsTestDouble, powIntegerCase1) {
+		double input = 1.5;
+		ASSERT_DOUBLE_EQ(Exponentials::pow<0>(input), 1.0);
+	}
+
+	TEST(ExponentialsTestDouble, powIntegerCase2) {
+		double input = 1.5;
+		ASSERT_DOUBLE_EQ(Exponentials::pow<7>(input), std::pow(input, 7.0));
+	}
+
+	TEST(ExponentialsTestDouble, powIntegerCase3) {
+		double input = 1.5;
+		ASSERT_DOUBLE_EQ(Exponentials::pow<8>(input), std::pow(input, 8.0));
+	}
+
+	TEST(ExponentialsTestDouble, powIntegerCase4) {
+		double input = 1.5;
+		ASSERT_DOUBLE_EQ(Exponentials::pow<-3>(input), std::pow(input, -3.0));
+	}
+
 	TEST(ExponentialsTestDouble, powCase1) {
 		double base = 3.5;
 		double exponent = 1.0;
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <array>
+#include <cstdlib>
+#include <limits>
+#include <string>
+
 #ifndef __MSC_VER
 	#include <cmath>
 #endif
@@ -59,6 +64,16 @@ namespace hyperion::math::test {
 		ASSERT_FLOAT_EQ(Exponentials::exp(input), std::exp(input));
 	}
 
+	TEST(ExponentialsTestFloat, expfCase5) {
+		float input = -80.0F;
+		ASSERT_FLOAT_EQ(Exponentials::exp(input), std::exp(input));
+	}
+
+	TEST(ExponentialsTestFloat, expfCase6) {
+		float input = 75.123F;
+		ASSERT_FLOAT_EQ(Exponentials::exp(input), std::exp(input));
+	}
+
 	TEST(ExponentialsTestFloat, lnfCase1) {
 		float input = 1.0F;
 		ASSERT_FLOAT_EQ(Exponentials::ln(input), std::log(input));
@@ -89,6 +104,53 @@ namespace hyperion::math::test {
 		ASSERT_NEAR(Exponentials::log10(input), std::log10(input), FLOAT_ACCEPTED_ERROR);
 	}
 
+	TEST(ExponentialsTestFloat, lnfCase3) {
+		float input = 1.0E30F;
+		ASSERT_NEAR(Exponentials::ln(input), std::log(input), FLOAT_ACCEPTED_ERROR);
+	}
+
+	TEST(ExponentialsTestFloat, lnfCase4) {
+		// subnormal
+		float input = 1.0E-40F;
+		ASSERT_NEAR(Exponentials::ln(input), std::log(input), FLOAT_ACCEPTED_ERROR);
+	}
+
+	TEST(ExponentialsTestFloat, lnfSpecialCases) {
+		ASSERT_EQ(Exponentials::ln(0.0F), -std::numeric_limits<float>::infinity());
+		ASSERT_TRUE(std::isnan(Exponentials::ln(-1.0F)));
+		ASSERT_EQ(Exponentials::ln(std::numeric_limits<float>::infinity()),
+				  std::numeric_limits<float>::infinity());
+	}
+
+	TEST(ExponentialsTestFloat, log2fCase3) {
+		float input = 1.0E30F;
+		ASSERT_NEAR(Exponentials::log2(input), std::log2(input), FLOAT_ACCEPTED_ERROR);
+	}
+
+	TEST(ExponentialsTestFloat, log10fCase3) {
+		float input = 1.0E30F;
+		ASSERT_NEAR(Exponentials::log10(input), std::log10(input), FLOAT_ACCEPTED_ERROR);
+	}
+
+	TEST(ExponentialsTestFloat, logfBatch) {
+		auto inputs = std::array<float, 64>();
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			inputs[i] = 0.001F + 1.5F * static_cast<float>(i * i);
+		}
+		auto lnOutputs = std::array<float, 64>();
+		auto log2Outputs = std::array<float, 64>();
+		auto log10Outputs = std::array<float, 64>();
+		Exponentials::ln(inputs, lnOutputs);
+		Exponentials::log2(inputs, log2Outputs);
+		Exponentials::log10(inputs, log10Outputs);
+
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			ASSERT_NEAR(lnOutputs[i], std::log(inputs[i]), FLOAT_ACCEPTED_ERROR);
+			ASSERT_NEAR(log2Outputs[i], std::log2(inputs[i]), FLOAT_ACCEPTED_ERROR);
+			ASSERT_NEAR(log10Outputs[i], std::log10(inputs[i]), FLOAT_ACCEPTED_ERROR);
+		}
+	}
+
 	TEST(ExponentialsTestFloat, pow2fCase1) {
 		float input = 1.0F;
 		ASSERT_NEAR(Exponentials::pow2(input), std::pow(2.0F, input), FLOAT_ACCEPTED_ERROR);
@@ -129,6 +191,55 @@ namespace hyperion::math::test {
 		ASSERT_NEAR(Exponentials::pow10(input), std::pow(10.0F, input), FLOAT_ACCEPTED_ERROR);
 	}
 
+	TEST(ExponentialsTestFloat, pow2fCase5) {
+		float input = 40.0F;
+		ASSERT_FLOAT_EQ(Exponentials::pow2(input), std::pow(2.0F, input));
+	}
+
+	TEST(ExponentialsTestFloat, pow2fCase6) {
+		float input = -40.0F;
+		ASSERT_FLOAT_EQ(Exponentials::pow2(input), std::pow(2.0F, input));
+	}
+
+	TEST(ExponentialsTestFloat, pow10fCase5) {
+		float input = 12.0F;
+		ASSERT_FLOAT_EQ(Exponentials::pow10(input), std::pow(10.0F, input));
+	}
+
+	TEST(ExponentialsTestFloat, pow10fCase6) {
+		float input = -12.0F;
+		ASSERT_FLOAT_EQ(Exponentials::pow10(input), std::pow(10.0F, input));
+	}
+
+	TEST(ExponentialsTestFloat, pow10fCase7) {
+		// integral powers must be the correctly rounded decimal value, i.e. exactly what the
+		// compiler would produce for the literal `1eN`
+		for(auto exponent = -37; exponent <= 38; ++exponent) {
+			const auto expected = std::strtof(("1e" + std::to_string(exponent)).c_str(), nullptr);
+			ASSERT_EQ(Exponentials::pow10(static_cast<float>(exponent)), expected) << exponent;
+		}
+	}
+
+	TEST(ExponentialsTestFloat, powfIntegerCase1) {
+		float input = 1.5F;
+		ASSERT_FLOAT_EQ(Exponentials::pow<0>(input), 1.0F);
+	}
+
+	TEST(ExponentialsTestFloat, powfIntegerCase2) {
+		float input = 1.5F;
+		ASSERT_FLOAT_EQ(Exponentials::pow<7>(input), std::pow(input, 7.0F));
+	}
+
+	TEST(ExponentialsTestFloat, powfIntegerCase3) {
+		float input = 1.5F;
+		ASSERT_FLOAT_EQ(Exponentials::pow<8>(input), std::pow(input, 8.0F));
+	}
+
+	TEST(ExponentialsTestFloat, powfIntegerCase4) {
+		float input = 1.5F;
+		ASSERT_FLOAT_EQ(Exponentials::pow<-3>(input), std::pow(input, -3.0F));
+	}
+
 	TEST(ExponentialsTestFloat, powfCase1) {
 		float base = 3.5F;
 		float exponent = 1.0F;
@@ -4,6 +4,7 @@
 	#include <cmath>
 #endif
 
+#include <array>
 #include <limits>
 
 #include "HyperionMath/General.h"
@@ -33,6 +34,71 @@ namespace hyperion::math::test {
 		ASSERT_NEAR(General::sqrt(input), std::sqrt(input), DOUBLE_ACCEPTED_ERROR);
 	}
 
+	TEST(GeneralTestDouble, sqrtConstexpr) {
+		constexpr double input = 2.0;
+		constexpr auto result = General::sqrt(input);
+		ASSERT_EQ(result, std::sqrt(input));
+	}
+
+	TEST(GeneralTestDouble, sqrtSpecialCases) {
+		ASSERT_EQ(General::sqrt(0.0), 0.0);
+		ASSERT_TRUE(std::isnan(General::sqrt(-1.0)));
+		ASSERT_EQ(General::sqrt(std::numeric_limits<double>::infinity()),
+				  std::numeric_limits<double>::infinity());
+	}
+
+	TEST(GeneralTestDouble, sqrtBatch) {
+		auto inputs = std::array<double, 64>();
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			inputs[i] = 0.25 * static_cast<double>(i * i) + 0.1;
+		}
+		auto outputs = std::array<double, 64>();
+		General::sqrt(inputs, outputs);
+
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			ASSERT_EQ(outputs[i], std::sqrt(inputs[i]));
+		}
+	}
+
+	TEST(GeneralTestDouble, rsqrtCase1) {
+		double input = 1.0;
+		ASSERT_NEAR(General::rsqrt<4>(input), 1.0 / std::sqrt(input), DOUBLE_ACCEPTED_ERROR);
+	}
+
+	TEST(GeneralTestDouble, rsqrtCase2) {
+		double input = 2.0;
+		ASSERT_NEAR(General::rsqrt<4>(input), 1.0 / std::sqrt(input), DOUBLE_ACCEPTED_ERROR);
+	}
+
+	TEST(GeneralTestDouble, rsqrtCase3) {
+		double input = 0.001;
+		ASSERT_NEAR(General::rsqrt<4>(input) * std::sqrt(input), 1.0, DOUBLE_ACCEPTED_ERROR);
+	}
+
+	TEST(GeneralTestDouble, rsqrtCase4) {
+		double input = 123456.0;
+		ASSERT_NEAR(General::rsqrt<4>(input) * std::sqrt(input), 1.0, DOUBLE_ACCEPTED_ERROR);
+	}
+
+	TEST(GeneralTestDouble, rsqrtDefaultIterations) {
+		// without an explicit number of Newton steps, double should still be precise
+		double input = 2.0;
+		ASSERT_NEAR(General::rsqrt(input) * std::sqrt(input), 1.0, 1.0E-12);
+	}
+
+	TEST(GeneralTestDouble, rsqrtBatch) {
+		auto inputs = std::array<double, 63>();
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			inputs[i] = 0.25 * static_cast<double>(i * i) + 0.1;
+		}
+		auto outputs = std::array<double, 63>();
+		General::rsqrt<4>(inputs, outputs);
+
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			ASSERT_NEAR(outputs[i] * std::sqrt(inputs[i]), 1.0, DOUBLE_ACCEPTED_ERROR);
+		}
+	}
+
 	TEST(GeneralTestDouble, fabsCase1) {
 		double input = 1.0;
 		ASSERT_NEAR(General::abs(input), std::fabs(input), DOUBLE_ACCEPTED_ERROR);
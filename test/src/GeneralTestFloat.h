@@ -4,7 +4,9 @@
 	#include <cmath>
 #endif
 
+#include <array>
 #include <limits>
+#include <span>
 
 #include "HyperionMath/General.h"
 #include "TestConstants.h"
@@ -33,6 +35,65 @@ namespace hyperion::math::test {
 		ASSERT_NEAR(General::sqrt(input), std::sqrt(input), FLOAT_ACCEPTED_ERROR);
 	}
 
+	TEST(GeneralTestFloat, sqrtfConstexpr) {
+		constexpr float input = 2.0F;
+		constexpr auto result = General::sqrt(input);
+		ASSERT_EQ(result, std::sqrt(input));
+	}
+
+	TEST(GeneralTestFloat, sqrtfSpecialCases) {
+		ASSERT_EQ(General::sqrt(0.0F), 0.0F);
+		ASSERT_TRUE(std::isnan(General::sqrt(-1.0F)));
+		ASSERT_EQ(General::sqrt(std::numeric_limits<float>::infinity()),
+				  std::numeric_limits<float>::infinity());
+	}
+
+	TEST(GeneralTestFloat, sqrtfBatch) {
+		auto inputs = std::array<float, 64>();
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			inputs[i] = 0.25F * static_cast<float>(i * i) + 0.1F;
+		}
+		auto outputs = std::array<float, 64>();
+		General::sqrt(inputs, outputs);
+
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			ASSERT_EQ(outputs[i], std::sqrt(inputs[i]));
+		}
+	}
+
+	TEST(GeneralTestFloat, rsqrtfCase1) {
+		float input = 1.0F;
+		ASSERT_NEAR(General::rsqrt<1>(input), 1.0F / std::sqrt(input), FLOAT_ACCEPTED_ERROR);
+	}
+
+	TEST(GeneralTestFloat, rsqrtfCase2) {
+		float input = 2.0F;
+		ASSERT_NEAR(General::rsqrt<1>(input), 1.0F / std::sqrt(input), FLOAT_ACCEPTED_ERROR);
+	}
+
+	TEST(GeneralTestFloat, rsqrtfCase3) {
+		float input = 0.001F;
+		ASSERT_NEAR(General::rsqrt<1>(input) * std::sqrt(input), 1.0F, FLOAT_ACCEPTED_ERROR);
+	}
+
+	TEST(GeneralTestFloat, rsqrtfCase4) {
+		float input = 123456.0F;
+		ASSERT_NEAR(General::rsqrt<1>(input) * std::sqrt(input), 1.0F, FLOAT_ACCEPTED_ERROR);
+	}
+
+	TEST(GeneralTestFloat, rsqrtfBatch) {
+		auto inputs = std::array<float, 63>();
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			inputs[i] = 0.25F * static_cast<float>(i * i) + 0.1F;
+		}
+		auto outputs = std::array<float, 63>();
+		General::rsqrt<1>(inputs, outputs);
+
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			ASSERT_NEAR(outputs[i] * std::sqrt(inputs[i]), 1.0F, FLOAT_ACCEPTED_ERROR);
+		}
+	}
+
 	TEST(GeneralTestFloat, fabsfCase1) {
 		float input = 1.0F;
 		ASSERT_NEAR(General::abs(input), std::fabs(input), FLOAT_ACCEPTED_ERROR);
@@ -150,4 +211,18 @@ namespace hyperion::math::test {
 		float input = -1.5F;
 		ASSERT_EQ(General::roundU(input), std::numeric_limits<size_t>::max());
 	}
+
+	TEST(GeneralTestFloat, bitEqual) {
+		ASSERT_TRUE(General::bit_equal(1.0F, 1.0F));
+		ASSERT_FALSE(General::bit_equal(0.0F, -0.0F));
+		ASSERT_FALSE(General::bit_equal(1.0F, std::nextafter(1.0F, 2.0F)));
+	}
+
+	TEST(GeneralTestFloat, scale) {
+		auto values = std::array<float, 3>{1.0F, -2.0F, 0.5F};
+		General::scale(std::span<float>(values), 1.0F);
+		ASSERT_EQ(values, (std::array<float, 3>{1.0F, -2.0F, 0.5F}));
+		General::scale(std::span<float>(values), 2.0F);
+		ASSERT_EQ(values, (std::array<float, 3>{2.0F, -4.0F, 1.0F}));
+	}
 } // namespace hyperion::math::test
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <array>
+#include <gtest/gtest.h>
+
+#include "HyperionMath/Interpolator.h"
+#include "HyperionMath/InterpolatorBank.h"
+
+namespace hyperion::math::test {
+
+	TEST(InterpolatorBankTest, linearBank) {
+		auto bank = InterpolatorBank<float, InterpolationType::Linear>(100ULL, 100ULL);
+		auto reference = Interpolator<float, InterpolationType::Linear>(1.0F, 0.0F, 1.0F, 100ULL);
+		bank.set_target(42ULL, 1.0F, 1.0F);
+
+		for(auto i = 0; i < 110; ++i) {
+			bank.advance();
+			ASSERT_NEAR(reference.get_next_value(), bank.value(42ULL), 1e-6F); // NOLINT
+		}
+		ASSERT_FLOAT_EQ(1.0F, bank.value(42ULL));
+		ASSERT_FLOAT_EQ(0.0F, bank.value(41ULL));
+	}
+
+	TEST(InterpolatorBankTest, logBank) {
+		auto bank = InterpolatorBank<double, InterpolationType::Logarithmic>(10ULL, 100ULL, 0.5);
+		auto reference
+			= Interpolator<double, InterpolationType::Logarithmic>(1.0, 0.5, 1.0, 100ULL);
+		bank.set_target(0ULL, 1.0, 1.0);
+
+		for(auto i = 0; i < 110; ++i) {
+			bank.advance();
+			ASSERT_NEAR(reference.get_next_value(), bank.value(0ULL), 1e-12); // NOLINT
+		}
+	}
+
+	template<InterpolationType Type>
+	inline auto expect_lane_matches_interpolator() -> void {
+		auto bank = InterpolatorBank<double, Type>(3ULL, 100ULL, 0.5);
+		auto reference = Interpolator<double, Type>(2.0, 0.5, 0.5, 100ULL);
+		bank.set_target(1ULL, 2.0, 0.5);
+		auto block = std::array<double, 16>();
+
+		// the transition is 51 samples long, so it finishes partway through a block
+		for(auto i = 0; i < 5; ++i) {
+			bank.process(1ULL, block);
+			for(const auto value : block) {
+				ASSERT_NEAR(reference.get_next_value(), value, 1e-9); // NOLINT
+			}
+		}
+		ASSERT_FALSE(bank.is_active(1ULL));
+		ASSERT_DOUBLE_EQ(reference.get_current_value(), bank.value(1ULL));
+	}
+
+	TEST(InterpolatorBankTest, laneMatchesInterpolator) {
+		expect_lane_matches_interpolator<InterpolationType::Linear>();
+		expect_lane_matches_interpolator<InterpolationType::Logarithmic>();
+		expect_lane_matches_interpolator<InterpolationType::Exponential>();
+	}
+
+	TEST(InterpolatorBankTest, activeSet) {
+		auto bank = InterpolatorBank<float, InterpolationType::Exponential>(130ULL, 100ULL);
+		ASSERT_EQ(0ULL, bank.num_active());
+
+		bank.set_target(3ULL, 1.0F, 0.1F);
+		bank.set_target(129ULL, 2.0F, 0.5F);
+		ASSERT_EQ(2ULL, bank.num_active());
+		ASSERT_TRUE(bank.is_active(129ULL));
+
+		bank.advance(20ULL);
+		ASSERT_EQ(1ULL, bank.num_active());
+		ASSERT_FALSE(bank.is_active(3ULL));
+		ASSERT_NEAR(1.0F, bank.value(3ULL), 1e-3F); // NOLINT
+
+		bank.set_value(129ULL, 0.25F);
+		ASSERT_EQ(0ULL, bank.num_active());
+		ASSERT_FLOAT_EQ(0.25F, bank.value(129ULL));
+		ASSERT_FLOAT_EQ(0.0F, bank.value(4ULL));
+	}
+
+	TEST(InterpolatorBankTest, processLane) {
+		auto bank = InterpolatorBank<float, InterpolationType::Logarithmic>(2ULL, 100ULL);
+		bank.set_target(1ULL, 1.0F, 1.0F);
+		auto reference = bank;
+		auto block = std::array<float, 64>();
+
+		for(auto i = 0; i < 2; ++i) {
+			bank.process(1ULL, block);
+			for(const auto value : block) {
+				reference.advance();
+				ASSERT_NEAR(reference.value(1ULL), value, 1e-6F); // NOLINT
+			}
+		}
+		ASSERT_FALSE(bank.is_active(1ULL));
+		ASSERT_EQ(0ULL, bank.num_active());
+	}
+} // namespace hyperion::math::test
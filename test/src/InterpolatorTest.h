@@ -1,6 +1,10 @@
 #pragma once
 
+#include <array>
+#include <cmath>
 #include <gtest/gtest.h>
+#include <span>
+#include <vector>
 
 #include "HyperionMath/General.h"
 #include "HyperionMath/Interpolator.h"
@@ -33,4 +37,346 @@ namespace hyperion::math::test {
 		ASSERT_TRUE(math::General::abs(interp.get_next_value(utils::Some(size_t(10))) - percent99)
 					<= (1.0F - percent99));
 	}
+
+	TEST(InterpolatorTest, linearProcess) {
+		auto interp = Interpolator<float, InterpolationType::Linear>(1.0F, 0.0F, 1.0F, 100ULL);
+		auto reference = interp;
+		auto block = std::array<float, 64>();
+
+		// the transition is 101 samples long, so the second block finishes it
+		for(auto i = 0; i < 3; ++i) {
+			interp.process(block);
+			for(const auto value : block) {
+				ASSERT_FLOAT_EQ(reference.get_next_value(), value);
+			}
+		}
+		ASSERT_FLOAT_EQ(1.0F, block.back());
+	}
+
+	TEST(InterpolatorTest, logProcess) {
+		auto interp
+			= Interpolator<double, InterpolationType::Logarithmic>(1.0, 0.0, 1.0, 100ULL);
+		auto reference = interp;
+		auto block = std::array<double, 64>();
+
+		for(auto i = 0; i < 3; ++i) {
+			interp.process(block);
+			for(const auto value : block) {
+				ASSERT_DOUBLE_EQ(reference.get_next_value(), value);
+			}
+		}
+	}
+
+	TEST(InterpolatorTest, linearApply) {
+		auto interp = Interpolator<float, InterpolationType::Linear>(0.5F, 1.0F, 1.0F, 100ULL);
+		auto reference = interp;
+		auto block = std::array<float, 64>();
+
+		for(auto i = 0; i < 3; ++i) {
+			block.fill(2.0F);
+			interp.apply(block);
+			for(const auto value : block) {
+				ASSERT_FLOAT_EQ(2.0F * reference.get_next_value(), value);
+			}
+		}
+		ASSERT_FLOAT_EQ(1.0F, block.back());
+	}
+
+	TEST(InterpolatorTest, setTargetAfterTransition) {
+		auto interp = Interpolator<float, InterpolationType::Linear>(1.0F, 0.0F, 1.0F, 10ULL);
+		auto block = std::array<float, 16>();
+
+		interp.process(block);
+		ASSERT_FLOAT_EQ(1.0F, block.back());
+
+		interp.set_target(0.5F);
+		interp.process(block);
+		ASSERT_FLOAT_EQ(1.0F, block.front());
+		ASSERT_FLOAT_EQ(0.75F, block[5]);
+		ASSERT_FLOAT_EQ(0.5F, block.back());
+	}
+
+	TEST(InterpolatorTest, incrementalLogProcess) {
+		auto exact
+			= Interpolator<float, InterpolationType::Logarithmic>(1.0F, 0.0F, 0.1F, 44100ULL);
+		auto incremental = exact;
+		incremental.set_incremental(true);
+		auto exactBlock = std::array<float, 100>();
+		auto incrementalBlock = std::array<float, 100>();
+
+		for(auto i = 0; i < 50; ++i) {
+			exact.process(exactBlock);
+			incremental.process(incrementalBlock);
+			for(auto j = 0ULL; j < exactBlock.size(); ++j) {
+				ASSERT_NEAR(exactBlock[j], incrementalBlock[j], 1e-5F); // NOLINT
+			}
+		}
+	}
+
+	TEST(InterpolatorTest, incrementalExpProcess) {
+		auto exact
+			= Interpolator<float, InterpolationType::Exponential>(0.2F, 1.0F, 0.1F, 44100ULL);
+		auto incremental = exact;
+		incremental.set_incremental(true);
+		auto exactBlock = std::array<float, 100>();
+		auto incrementalBlock = std::array<float, 100>();
+
+		for(auto i = 0; i < 50; ++i) {
+			exact.process(exactBlock);
+			incremental.process(incrementalBlock);
+			for(auto j = 0ULL; j < exactBlock.size(); ++j) {
+				ASSERT_NEAR(exactBlock[j], incrementalBlock[j], 1e-5F); // NOLINT
+			}
+		}
+	}
+
+	TEST(InterpolatorTest, incrementalGetNextValue) {
+		auto interp
+			= Interpolator<double, InterpolationType::Logarithmic>(1.0, 0.5, 0.1, 44100ULL);
+		interp.set_incremental(true);
+		auto reference = interp;
+		auto block = std::array<double, 100>();
+
+		for(auto i = 0; i < 50; ++i) {
+			interp.process(block);
+			for(const auto value : block) {
+				ASSERT_DOUBLE_EQ(reference.get_next_value(), value);
+			}
+		}
+	}
+
+	TEST(InterpolatorTest, smoothstepInterpolator) {
+		auto interp = Interpolator<double, InterpolationType::Smoothstep>(2.0, 1.0, 1.0, 100ULL);
+
+		for(auto i = 0; i <= 100; ++i) {
+			const auto t = static_cast<double>(i) / 100.0;
+			ASSERT_NEAR(1.0 + t * t * (3.0 - 2.0 * t), interp.get_next_value(), 1e-12); // NOLINT
+		}
+		ASSERT_DOUBLE_EQ(2.0, interp.get_next_value());
+	}
+
+	TEST(InterpolatorTest, cubicHermiteTangents) {
+		auto interp
+			= Interpolator<float, InterpolationType::CubicHermite>(1.0F, 0.0F, 1.0F, 100ULL);
+		auto reference = Interpolator<float, InterpolationType::Linear>(1.0F, 0.0F, 1.0F, 100ULL);
+		// unit tangents at both ends make the curve the linear ramp
+		interp.set_tangents(1.0F, 1.0F);
+		auto block = std::array<float, 64>();
+
+		for(auto i = 0; i < 2; ++i) {
+			interp.process(block);
+			for(const auto value : block) {
+				ASSERT_NEAR(reference.get_next_value(), value, 1e-6F); // NOLINT
+			}
+		}
+	}
+
+	TEST(InterpolatorTest, smoothstepProcess) {
+		auto interp = Interpolator<float, InterpolationType::Smoothstep>(0.5F, 1.0F, 1.0F, 100ULL);
+		auto reference = interp;
+		auto block = std::array<float, 64>();
+
+		for(auto i = 0; i < 3; ++i) {
+			interp.process(block);
+			for(const auto value : block) {
+				ASSERT_NEAR(reference.get_next_value(), value, 1e-6F); // NOLINT
+			}
+		}
+		ASSERT_FLOAT_EQ(0.5F, block.back());
+	}
+
+	TEST(InterpolatorTest, cosineInterpolator) {
+		auto interp = Interpolator<double, InterpolationType::Cosine>(1.0, 0.0, 1.0, 100ULL);
+		const auto pi = 3.14159265358979323846;
+
+		for(auto i = 0; i <= 100; ++i) {
+			const auto t = static_cast<double>(i) / 100.0;
+			ASSERT_NEAR((1.0 - std::cos(pi * t)) / 2.0, interp.get_next_value(), 1e-9); // NOLINT
+		}
+	}
+
+	TEST(InterpolatorTest, equalPowerCrossfade) {
+		auto fadeIn
+			= Interpolator<float, InterpolationType::EqualPower>(1.0F, 0.0F, 0.1F, 44100ULL);
+		auto fadeOut
+			= Interpolator<float, InterpolationType::EqualPower>(0.0F, 1.0F, 0.1F, 44100ULL);
+		auto in = std::array<float, 100>();
+		auto out = std::array<float, 100>();
+
+		for(auto i = 0; i < 45; ++i) {
+			fadeIn.process(in);
+			fadeOut.process(out);
+			for(auto j = 0ULL; j < in.size(); ++j) {
+				ASSERT_NEAR(1.0F, in[j] * in[j] + out[j] * out[j], 1e-5F); // NOLINT
+			}
+		}
+		ASSERT_NEAR(1.0F, in.back(), 1e-6F); // NOLINT
+		ASSERT_NEAR(0.0F, out.back(), 1e-6F); // NOLINT
+	}
+
+	TEST(InterpolatorTest, incrementalCosineGetNextValue) {
+		auto exact = Interpolator<float, InterpolationType::Cosine>(0.2F, 1.0F, 0.1F, 44100ULL);
+		auto incremental = exact;
+		incremental.set_incremental(true);
+		auto block = std::array<float, 100>();
+
+		for(auto i = 0; i < 50; ++i) {
+			exact.process(block);
+			for(const auto value : block) {
+				ASSERT_NEAR(value, incremental.get_next_value(), 1e-5F); // NOLINT
+			}
+		}
+	}
+
+	TEST(InterpolatorTest, settledState) {
+		auto interp = Interpolator<float, InterpolationType::Linear>(2.0F, 0.0F, 0.1F, 100ULL);
+		auto block = std::array<float, 8>();
+		ASSERT_FALSE(interp.is_settled());
+		ASSERT_EQ(11ULL, interp.samples_remaining());
+
+		ASSERT_FALSE(interp.process(block));
+		ASSERT_EQ(3ULL, interp.samples_remaining());
+		// the transition finishes during this block, so it isn't constant
+		ASSERT_FALSE(interp.process(block));
+		ASSERT_TRUE(interp.is_settled());
+		ASSERT_EQ(0ULL, interp.samples_remaining());
+
+		ASSERT_TRUE(interp.process(block));
+		for(const auto value : block) {
+			ASSERT_FLOAT_EQ(2.0F, value);
+		}
+
+		interp.set_target(1.0F);
+		ASSERT_FALSE(interp.is_settled());
+		ASSERT_EQ(11ULL, interp.samples_remaining());
+	}
+
+	TEST(InterpolatorTest, settledUnityApply) {
+		auto interp = Interpolator<float, InterpolationType::Linear>(1.0F, 1.0F, 0.01F, 100ULL);
+		auto block = std::array<float, 8>({1.0F, 2.0F, 3.0F, 4.0F, 5.0F, 6.0F, 7.0F, 8.0F});
+		interp.get_next_value();
+		interp.get_next_value();
+		ASSERT_TRUE(interp.is_settled());
+
+		ASSERT_TRUE(interp.apply(block));
+		for(auto i = 0ULL; i < block.size(); ++i) {
+			ASSERT_FLOAT_EQ(static_cast<float>(i + 1ULL), block[i]); // NOLINT
+		}
+	}
+
+	TEST(InterpolatorTest, setSampleRateKeepsProgress) {
+		auto interp = Interpolator<float, InterpolationType::Linear>(1.0F, 0.0F, 1.0F, 100ULL);
+		for(auto i = 0; i < 50; ++i) {
+			interp.get_next_value();
+		}
+		ASSERT_NEAR(0.49F, interp.get_current_value(), 1e-6F); // NOLINT
+
+		interp.set_sample_rate(200ULL);
+		ASSERT_EQ(200ULL, interp.get_sample_rate());
+		ASSERT_EQ(101ULL, interp.samples_remaining());
+		ASSERT_NEAR(0.5F, interp.get_next_value(), 1e-6F); // NOLINT
+		ASSERT_NEAR(0.505F, interp.get_next_value(), 1e-6F); // NOLINT
+
+		interp.set_sample_rate(50ULL);
+		ASSERT_NEAR(0.52F, interp.get_next_value(), 1e-6F); // NOLINT
+	}
+
+	TEST(InterpolatorTest, setSampleRateKeepsCurve) {
+		auto interp
+			= Interpolator<double, InterpolationType::Logarithmic>(1.0, 0.0, 1.0, 44100ULL);
+		auto reference
+			= Interpolator<double, InterpolationType::Logarithmic>(1.0, 0.0, 1.0, 48000ULL);
+		auto block = std::array<double, 441>();
+		for(auto i = 0; i < 50; ++i) {
+			interp.process(block);
+		}
+
+		// half a second in, at either rate
+		interp.set_sample_rate(48000ULL);
+		reference.get_next_value(utils::Some(size_t(23999)));
+		for(auto i = 0; i < 1000; ++i) {
+			ASSERT_DOUBLE_EQ(reference.get_next_value(), interp.get_next_value());
+		}
+	}
+
+	TEST(InterpolatorTest, setSampleRateWhenSettled) {
+		auto interp = Interpolator<float, InterpolationType::Linear>(1.0F, 0.0F, 0.1F, 100ULL);
+		auto block = std::array<float, 16>();
+		interp.process(block);
+		ASSERT_TRUE(interp.is_settled());
+
+		interp.set_sample_rate(1000ULL);
+		ASSERT_TRUE(interp.is_settled());
+		ASSERT_TRUE(interp.process(block));
+		ASSERT_FLOAT_EQ(1.0F, block.front());
+	}
+
+	TEST(InterpolatorTest, oversampling) {
+		auto interp = Interpolator<float, InterpolationType::Smoothstep>(1.0F, 0.0F, 1.0F, 100ULL);
+		auto reference = interp;
+		auto block = std::array<float, 40>();
+		interp.process(std::span<float>(block).first(10));
+		for(auto i = 0; i < 10; ++i) {
+			reference.get_next_value();
+		}
+
+		// each base rate sample is now four oversampled ones
+		interp.set_oversampling_factor(4ULL);
+		ASSERT_EQ(4ULL, interp.get_oversampling_factor());
+		ASSERT_EQ(100ULL, interp.get_sample_rate());
+		for(auto i = 0; i < 3; ++i) {
+			interp.process(block);
+			for(auto j = 0ULL; j < block.size(); j += 4ULL) {
+				ASSERT_NEAR(reference.get_next_value(), block[j], 1e-6F); // NOLINT
+			}
+		}
+
+		interp.set_oversampling_factor(1ULL);
+		ASSERT_NEAR(reference.get_next_value(), interp.get_next_value(), 1e-6F); // NOLINT
+	}
+
+	TEST(InterpolatorTest, applyPlanar) {
+		// long enough to need more than one chunk of ramp values
+		auto interp = Interpolator<float, InterpolationType::Cosine>(0.0F, 1.0F, 0.01F, 48000ULL);
+		auto reference = interp;
+		auto left = std::vector<float>(600ULL, 2.0F);
+		auto right = std::vector<float>(600ULL, -1.0F);
+		const auto channels = std::array<std::span<float>, 2>{left, right};
+
+		ASSERT_FALSE(interp.apply_planar(channels));
+		for(auto i = 0ULL; i < left.size(); ++i) {
+			const auto value = reference.get_next_value();
+			ASSERT_FLOAT_EQ(2.0F * value, left[i]);
+			ASSERT_FLOAT_EQ(-value, right[i]);
+		}
+		ASSERT_NEAR(0.0F, left.back(), 1e-6F); // NOLINT
+	}
+
+	TEST(InterpolatorTest, applyInterleaved) {
+		auto stereo = Interpolator<float, InterpolationType::Linear>(1.0F, 0.0F, 0.1F, 1000ULL);
+		auto surround = Interpolator<double, InterpolationType::Smoothstep>(0.5, 1.0, 0.1, 1000ULL);
+		auto stereoReference = stereo;
+		auto surroundReference = surround;
+		auto stereoBuffer = std::vector<float>(2ULL * 128ULL, 1.0F);
+		auto surroundBuffer = std::vector<double>(6ULL * 128ULL, 3.0);
+
+		ASSERT_FALSE(stereo.apply_interleaved<2ULL>(stereoBuffer));
+		ASSERT_FALSE(surround.apply_interleaved(surroundBuffer, 6ULL));
+		for(auto frame = 0ULL; frame < 128ULL; ++frame) {
+			const auto stereoValue = stereoReference.get_next_value();
+			const auto surroundValue = surroundReference.get_next_value();
+			for(auto channel = 0ULL; channel < 2ULL; ++channel) {
+				ASSERT_FLOAT_EQ(stereoValue, stereoBuffer[frame * 2ULL + channel]);
+			}
+			for(auto channel = 0ULL; channel < 6ULL; ++channel) {
+				ASSERT_DOUBLE_EQ(3.0 * surroundValue, surroundBuffer[frame * 6ULL + channel]);
+			}
+		}
+		ASSERT_FLOAT_EQ(1.0F, stereoBuffer.back());
+		ASSERT_DOUBLE_EQ(1.5, surroundBuffer.back());
+
+		// settled at unity gain, so the buffer is left untouched
+		ASSERT_TRUE(stereo.apply_interleaved(stereoBuffer, 2ULL));
+		ASSERT_FLOAT_EQ(0.0F, stereoBuffer.front());
+	}
 } // namespace hyperion::math::test
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <array>
+#include <gtest/gtest.h>
+#include <span>
+#include <type_traits>
+
+#include "HyperionMath/Exponentials.h"
+#include "HyperionMath/RampTable.h"
+
+namespace hyperion::math::test {
+
+	static_assert(Exponentials::exp(0.0F) > 0.999F && Exponentials::exp(0.0F) < 1.001F,
+				  "Exponentials::exp must be usable in constant evaluation");
+	static_assert(Exponentials::exp(-1.0) > 0.3678 && Exponentials::exp(-1.0) < 0.3679,
+				  "Exponentials::exp must be usable in constant evaluation");
+
+	inline constexpr auto DECLICK_FADE_OUT
+		= make_ramp_table<float, InterpolationType::Cosine, 64ULL>(0.0F, 1.0F);
+
+	static_assert(DECLICK_FADE_OUT.front() > 0.999F && DECLICK_FADE_OUT.back() < 0.001F,
+				  "make_ramp_table must be usable in constant evaluation");
+
+	static_assert(std::is_constructible_v<TableInterpolator<float, 64ULL>,
+										  const std::array<float, 64ULL>&>,
+				  "TableInterpolator must accept a table it can reference");
+	static_assert(!std::is_constructible_v<TableInterpolator<float, 64ULL>,
+										   std::array<float, 64ULL>>,
+				  "TableInterpolator must reject a temporary table, which would dangle");
+
+	template<InterpolationType Type>
+	inline auto expect_matches_interpolator() -> void {
+		constexpr auto table = make_ramp_table<double, Type, 33ULL>(2.0, 0.5);
+		auto interpolator = Interpolator<double, Type>(2.0, 0.5, 1.0, 32ULL);
+		for(const auto value : table) {
+			ASSERT_DOUBLE_EQ(interpolator.get_next_value(), value);
+		}
+	}
+
+	TEST(RampTableTest, matchesInterpolator) {
+		expect_matches_interpolator<InterpolationType::Linear>();
+		expect_matches_interpolator<InterpolationType::Logarithmic>();
+		expect_matches_interpolator<InterpolationType::Exponential>();
+		expect_matches_interpolator<InterpolationType::Cosine>();
+		expect_matches_interpolator<InterpolationType::EqualPower>();
+		expect_matches_interpolator<InterpolationType::CubicHermite>();
+		expect_matches_interpolator<InterpolationType::Smoothstep>();
+	}
+
+	TEST(RampTableTest, tableInterpolatorProcess) {
+		auto interpolator = TableInterpolator(DECLICK_FADE_OUT);
+		auto block = std::array<float, 48>();
+
+		ASSERT_FALSE(interpolator.process(block));
+		for(auto i = 0ULL; i < block.size(); ++i) {
+			ASSERT_FLOAT_EQ(DECLICK_FADE_OUT[i], block[i]); // NOLINT
+		}
+		ASSERT_EQ(16ULL, interpolator.samples_remaining());
+
+		ASSERT_FALSE(interpolator.process(block));
+		ASSERT_TRUE(interpolator.is_settled());
+		ASSERT_FLOAT_EQ(DECLICK_FADE_OUT[63], block[15]);
+		ASSERT_FLOAT_EQ(DECLICK_FADE_OUT.back(), block.back());
+		ASSERT_TRUE(interpolator.process(block));
+
+		interpolator.reset();
+		ASSERT_FLOAT_EQ(DECLICK_FADE_OUT[0], interpolator.get_next_value());
+		ASSERT_FLOAT_EQ(DECLICK_FADE_OUT[1], interpolator.get_next_value());
+	}
+
+	TEST(RampTableTest, tableInterpolatorApply) {
+		static constexpr auto fadeIn
+			= make_ramp_table<float, InterpolationType::Smoothstep, 16ULL>();
+		auto interpolator = TableInterpolator(fadeIn);
+		auto block = std::array<float, 24>();
+		block.fill(2.0F);
+
+		ASSERT_FALSE(interpolator.apply(block));
+		for(auto i = 0ULL; i < fadeIn.size(); ++i) {
+			ASSERT_FLOAT_EQ(2.0F * fadeIn[i], block[i]); // NOLINT
+		}
+		ASSERT_FLOAT_EQ(2.0F, block.back());
+		ASSERT_FLOAT_EQ(1.0F, interpolator.get_current_value());
+	}
+} // namespace hyperion::math::test
@@ -0,0 +1,366 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "HyperionMath/Random.h"
+
+namespace hyperion::math::test {
+
+	static_assert(RandomEngine<LinearCongruentialEngine<>>);
+	static_assert(RandomEngine<EngineAdaptor<LinearCongruentialEngine<>>>);
+	static_assert(RandomEngine<SplitMix64Engine>);
+	static_assert(RandomEngine<Xoshiro256PlusPlusEngine>);
+	static_assert(RandomEngine<Xoshiro128PlusEngine>);
+	static_assert(RandomEngine<Pcg32Engine>);
+	static_assert(RandomEngine<Pcg64Engine>);
+	static_assert(std::uniform_random_bit_generator<SplitMix64Engine>);
+	static_assert(std::uniform_random_bit_generator<Xoshiro256PlusPlusEngine>);
+	static_assert(std::uniform_random_bit_generator<Xoshiro128PlusEngine>);
+	static_assert(std::uniform_random_bit_generator<Pcg32Engine>);
+	static_assert(std::uniform_random_bit_generator<Pcg64Engine>);
+	static_assert(RandomEngine<Philox4x32Engine>);
+	static_assert(std::uniform_random_bit_generator<Philox4x32Engine>);
+	static_assert(Philox4x32Engine::block({0U, 0U, 0U, 0U}, {0U, 0U})[0] == 0x6627E8D5U,
+				  "Philox4x32Engine::block must be usable in constant evaluation");
+	static_assert(RandomDistribution<UniformDistribution<LinearCongruentialEngine<>, float>>);
+	static_assert(
+		!std::is_polymorphic_v<UniformDistribution<LinearCongruentialEngine<>, float>>,
+		"UniformDistribution must not pay for virtual dispatch");
+
+	static constexpr size_t RANDOM_TEST_SEED = 12345ULL;
+	static constexpr size_t RANDOM_TEST_SAMPLES = 1000ULL;
+
+	TEST(RandomTest, uniformDistributionStaysInRange) {
+		auto distribution = UniformDistribution<LinearCongruentialEngine<>, float>(-2.0F, 3.0F);
+		for(auto i = 0ULL; i < RANDOM_TEST_SAMPLES; ++i) {
+			const auto value = distribution();
+			ASSERT_GE(value, -2.0F);
+			ASSERT_LE(value, 3.0F);
+		}
+	}
+
+	TEST(RandomTest, uniformDistributionKeepsEngineSeed) {
+		auto engine = LinearCongruentialEngine<>();
+		engine.seed(RANDOM_TEST_SEED);
+		auto distribution = UniformDistribution<LinearCongruentialEngine<>, double>(engine);
+		for(auto i = 0ULL; i < RANDOM_TEST_SAMPLES; ++i) {
+			const auto expected = static_cast<double>(engine.generate())
+								  / static_cast<double>(engine.max_value());
+			ASSERT_DOUBLE_EQ(distribution(), expected);
+		}
+	}
+
+	TEST(RandomTest, engineAdaptorMatchesEngine) {
+		auto engine = LinearCongruentialEngine<>();
+		engine.seed(RANDOM_TEST_SEED);
+		auto adaptor = EngineAdaptor<LinearCongruentialEngine<>>(engine);
+		Engine& erased = adaptor;
+		ASSERT_EQ(erased.max_value(), engine.max_value());
+		for(auto i = 0ULL; i < RANDOM_TEST_SAMPLES; ++i) {
+			ASSERT_EQ(erased(), engine.generate());
+		}
+
+		const auto values = erased.generate_array<4ULL>();
+		const auto expected = engine.generate_array<4ULL>();
+		ASSERT_EQ(values, expected);
+	}
+
+	TEST(RandomTest, distributionAdaptorMatchesDistribution) {
+		using Uniform = UniformDistribution<LinearCongruentialEngine<>, float>;
+		auto distribution = Uniform(-1.0F, 1.0F);
+		distribution.seed(RANDOM_TEST_SEED);
+		auto adaptor = DistributionAdaptor<Uniform>(distribution);
+		Distribution<LinearCongruentialEngine<>, float>& erased = adaptor;
+		ASSERT_FLOAT_EQ(erased.get_min(), -1.0F);
+		ASSERT_FLOAT_EQ(erased.get_max(), 1.0F);
+		for(auto i = 0ULL; i < RANDOM_TEST_SAMPLES; ++i) {
+			ASSERT_FLOAT_EQ(erased(), distribution());
+		}
+	}
+
+	template<typename EngineType, size_t N>
+	inline auto
+	expect_sequence(EngineType engine,
+					const std::array<typename EngineType::result_type, N>& expected) -> void {
+		for(const auto value : expected) {
+			ASSERT_EQ(engine(), value);
+		}
+	}
+
+	TEST(RandomTest, splitMix64KnownAnswer) {
+		expect_sequence(SplitMix64Engine(1234567ULL),
+						std::array<std::uint64_t, 1>{0x599ED017FB08FC85ULL});
+		expect_sequence(
+			SplitMix64Engine(0ULL),
+			std::array<std::uint64_t, 3>{0xE220A8397B1DCDAFULL,
+										 0x6E789E6AA1B965F4ULL,
+										 0x06C45D188009454FULL});
+	}
+
+	TEST(RandomTest, pcg32KnownAnswer) {
+		// the reference `pcg32-demo` output for seed 42, stream 54
+		expect_sequence(Pcg32Engine(42ULL, 54ULL),
+						std::array<std::uint32_t, 6>{0xA15C02B7U,
+													 0x7B47F409U,
+													 0xBA1D3330U,
+													 0x83D2F293U,
+													 0xBFA4784BU,
+													 0xCBED606EU});
+		ASSERT_EQ(Pcg32Engine(42ULL, 54ULL).get_stream(), 54ULL);
+	}
+
+	TEST(RandomTest, xoshiro256PlusPlusKnownAnswer) {
+		expect_sequence(Xoshiro256PlusPlusEngine(RANDOM_TEST_SEED),
+						std::array<std::uint64_t, 4>{0x8D948A82DEF8A568ULL,
+													 0x3477F953796702A0ULL,
+													 0x15CAA2FCE6DB8D69ULL,
+													 0x2CEF8853C20C6DD0ULL});
+	}
+
+	TEST(RandomTest, xoshiro128PlusKnownAnswer) {
+		expect_sequence(
+			Xoshiro128PlusEngine(RANDOM_TEST_SEED),
+			std::array<std::uint32_t, 4>{0xDE3FEE85U, 0xBAA437D0U, 0x6DA600ECU, 0xE57A2A24U});
+	}
+
+	TEST(RandomTest, pcg64KnownAnswer) {
+		expect_sequence(Pcg64Engine(RANDOM_TEST_SEED),
+						std::array<std::uint64_t, 4>{0xD11B1D37BFF50104ULL,
+													 0x92E63E7AE540560CULL,
+													 0xC8C14150EF8DEFAFULL,
+													 0xAE4F5C25C864B6B7ULL});
+	}
+
+	TEST(RandomTest, uint128MultiplyHigh) {
+		ASSERT_EQ(UInt128::multiply_high(0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL),
+				  0xFFFFFFFFFFFFFFFEULL);
+		ASSERT_EQ(UInt128::multiply_high(0x0123456789ABCDEFULL, 0xFEDCBA9876543210ULL),
+				  0x0121FA00AD77D742ULL);
+	}
+
+	TEST(RandomTest, enginesReseedDeterministically) {
+		auto engine = Xoshiro256PlusPlusEngine(RANDOM_TEST_SEED);
+		const auto first = engine.generate_array<8ULL>();
+		engine.seed(engine.get_seed());
+		ASSERT_EQ(engine.generate_array<8ULL>(), first);
+	}
+
+	TEST(RandomTest, enginesWorkWithStandardDistributions) {
+		auto engine = Pcg64Engine(RANDOM_TEST_SEED);
+		auto distribution = std::uniform_real_distribution<double>(-1.0, 1.0);
+		for(auto i = 0ULL; i < RANDOM_TEST_SAMPLES; ++i) {
+			const auto value = distribution(engine);
+			ASSERT_GE(value, -1.0);
+			ASSERT_LT(value, 1.0);
+		}
+	}
+
+	TEST(RandomTest, uniformDistributionWithXoshiro) {
+		auto distribution
+			= UniformDistribution<Xoshiro256PlusPlusEngine, float>(-2.0F, 3.0F);
+		for(auto i = 0ULL; i < RANDOM_TEST_SAMPLES; ++i) {
+			const auto value = distribution();
+			ASSERT_GE(value, -2.0F);
+			ASSERT_LE(value, 3.0F);
+		}
+	}
+
+	TEST(RandomTest, philoxKnownAnswer) {
+		// the Random123 known-answer vectors for philox4x32_10
+		using Block = std::array<std::uint32_t, 4>;
+		ASSERT_EQ(Philox4x32Engine::block({0U, 0U, 0U, 0U}, {0U, 0U}),
+				  (Block{0x6627E8D5U, 0xE169C58DU, 0xBC57AC4CU, 0x9B00DBD8U}));
+		ASSERT_EQ(Philox4x32Engine::block({0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU},
+										  {0xFFFFFFFFU, 0xFFFFFFFFU}),
+				  (Block{0x408F276DU, 0x41C83B0EU, 0xA20BC7C6U, 0x6D5451FDU}));
+		ASSERT_EQ(Philox4x32Engine::block({0x243F6A88U, 0x85A308D3U, 0x13198A2EU, 0x03707344U},
+										  {0xA4093822U, 0x299F31D0U}),
+				  (Block{0xD16CFE09U, 0x94FDCCEBU, 0x5001E420U, 0x24126EA1U}));
+	}
+
+	TEST(RandomTest, philoxGeneratesCounterBlocks) {
+		constexpr auto seed = 0x0123456789ABCDEFULL;
+		constexpr auto stream = 7ULL;
+		auto engine = Philox4x32Engine(seed, stream);
+		ASSERT_EQ(engine.get_stream(), stream);
+		for(auto blockIndex = 0U; blockIndex < 3U; ++blockIndex) {
+			const auto expected
+				= Philox4x32Engine::block({blockIndex, 0U, 7U, 0U}, {0x89ABCDEFU, 0x01234567U});
+			for(const auto value : expected) {
+				ASSERT_EQ(engine(), value);
+			}
+		}
+	}
+
+	TEST(RandomTest, philoxFillMatchesGenerate) {
+		auto sequential = Philox4x32Engine(RANDOM_TEST_SEED, 3ULL);
+		auto batched = sequential;
+		// start mid-block, then cover whole batches and a partial one
+		ASSERT_EQ(batched(), sequential());
+		constexpr auto batchValues = Philox4x32Engine::BATCH_BLOCKS * 4ULL;
+		auto values = std::vector<std::uint32_t>(batchValues * 3ULL + 5ULL);
+		batched.fill(values);
+		for(const auto value : values) {
+			ASSERT_EQ(value, sequential());
+		}
+		ASSERT_EQ(batched(), sequential());
+	}
+
+	TEST(RandomTest, philoxFillUniform) {
+		auto engine = Philox4x32Engine(RANDOM_TEST_SEED);
+		auto values = std::vector<float>(RANDOM_TEST_SAMPLES);
+		engine.fill_uniform(std::span<float>(values), -1.0F, 1.0F);
+		for(const auto value : values) {
+			ASSERT_GE(value, -1.0F);
+			ASSERT_LT(value, 1.0F);
+		}
+	}
+
+	TEST(RandomTest, randomValueStaysInRange) {
+		for(auto i = 0ULL; i < RANDOM_TEST_SAMPLES; ++i) {
+			const auto normalized = random_value<float>();
+			ASSERT_GE(normalized, 0.0F);
+			ASSERT_LT(normalized, 1.0F);
+
+			const auto value = random_value(-4.0, -2.0);
+			ASSERT_GE(value, -4.0);
+			ASSERT_LT(value, -2.0);
+
+			const auto integer = random_value(3, 7);
+			ASSERT_GE(integer, 3);
+			ASSERT_LT(integer, 7);
+		}
+	}
+
+	TEST(RandomTest, randomIntegerIsUniformAcrossZero) {
+		// every value of a range spanning zero, including `min`, should be about equally likely
+		constexpr auto samples = 100000ULL;
+		auto counts = std::array<std::uint64_t, 10>();
+		for(auto i = 0ULL; i < samples; ++i) {
+			const auto value = random_value(-5, 5);
+			ASSERT_GE(value, -5);
+			ASSERT_LT(value, 5);
+			++counts[static_cast<size_t>(value + 5)]; // NOLINT
+		}
+
+		for(const auto count : counts) {
+			ASSERT_GT(count, samples / 10ULL * 9ULL / 10ULL);
+			ASSERT_LT(count, samples / 10ULL * 11ULL / 10ULL);
+		}
+	}
+
+	TEST(RandomTest, threadsHaveIndependentEngines) {
+		const auto draw = []() { return thread_random_engine().generate_array<4ULL>(); };
+		auto first = std::array<std::uint64_t, 4>();
+		auto second = std::array<std::uint64_t, 4>();
+		auto firstThread = std::thread([&]() { first = draw(); });
+		auto secondThread = std::thread([&]() { second = draw(); });
+		firstThread.join();
+		secondThread.join();
+
+		ASSERT_NE(first, second);
+		ASSERT_NE(first, draw());
+	}
+
+	template<typename EngineType>
+	inline auto expect_jump_matches_generate(EngineType engine, std::uint64_t steps) -> void {
+		auto jumped = engine;
+		jumped.jump(steps);
+		for(auto i = 0ULL; i < steps; ++i) {
+			static_cast<void>(engine.generate());
+		}
+		for(auto i = 0ULL; i < 8ULL; ++i) {
+			ASSERT_EQ(jumped.generate(), engine.generate());
+		}
+	}
+
+	TEST(RandomTest, jumpMatchesGenerate) {
+		for(const auto steps : {0ULL, 1ULL, 2ULL, 5ULL, 1000ULL, 12345ULL}) {
+			auto engine = LinearCongruentialEngine<>();
+			engine.seed(RANDOM_TEST_SEED);
+			static_cast<void>(engine.generate());
+			expect_jump_matches_generate(engine, steps);
+			expect_jump_matches_generate(SplitMix64Engine(RANDOM_TEST_SEED), steps);
+			expect_jump_matches_generate(Pcg32Engine(RANDOM_TEST_SEED, 3ULL), steps);
+			expect_jump_matches_generate(Pcg64Engine(RANDOM_TEST_SEED), steps);
+
+			// start from every offset within a Philox block
+			auto philox = Philox4x32Engine(RANDOM_TEST_SEED, 3ULL);
+			for(auto offset = 0; offset < 4; ++offset) {
+				expect_jump_matches_generate(philox, steps);
+				static_cast<void>(philox.generate());
+			}
+		}
+	}
+
+	TEST(RandomTest, pcgJumpWrapsAroundPeriod) {
+		// PCG32's period is 2^64, so 2^64 - 1 steps and then one more return to the start
+		auto engine = Pcg32Engine(RANDOM_TEST_SEED, 3ULL);
+		const auto expected = engine;
+		engine.jump(std::numeric_limits<std::uint64_t>::max());
+		engine.jump(1ULL);
+		ASSERT_EQ(engine.generate_array<4ULL>(), Pcg32Engine(expected).generate_array<4ULL>());
+
+		auto wide = Pcg64Engine(RANDOM_TEST_SEED);
+		auto twoJumps = wide;
+		wide.jump(0x8000000000000001ULL);
+		twoJumps.jump(0x4000000000000000ULL);
+		twoJumps.jump(0x4000000000000001ULL);
+		ASSERT_EQ(wide.generate_array<4ULL>(), twoJumps.generate_array<4ULL>());
+	}
+
+	TEST(RandomTest, xoshiroJumpKnownAnswer) {
+		auto engine256 = Xoshiro256PlusPlusEngine(RANDOM_TEST_SEED);
+		engine256.jump();
+		expect_sequence(engine256,
+						std::array<std::uint64_t, 2>{0xE4EBF8BA2DAF15F0ULL, 0xE2B064868A4F356DULL});
+		engine256.seed(RANDOM_TEST_SEED);
+		engine256.long_jump();
+		expect_sequence(engine256,
+						std::array<std::uint64_t, 2>{0x944D9A4CB7962900ULL, 0xE09121F7A3B650D3ULL});
+
+		auto engine128 = Xoshiro128PlusEngine(RANDOM_TEST_SEED);
+		engine128.jump();
+		expect_sequence(engine128, std::array<std::uint32_t, 2>{0x79236E02U, 0xB6C4B262U});
+		engine128.seed(RANDOM_TEST_SEED);
+		engine128.long_jump();
+		expect_sequence(engine128, std::array<std::uint32_t, 2>{0xEEC50C76U, 0x188533B6U});
+	}
+
+	template<typename EngineType>
+	inline auto expect_split_is_independent(EngineType engine) -> void {
+		auto first = engine.split();
+		auto second = engine.split();
+		const auto parentValues = engine.template generate_array<4ULL>();
+		const auto firstValues = first.template generate_array<4ULL>();
+		const auto secondValues = second.template generate_array<4ULL>();
+		ASSERT_NE(firstValues, secondValues);
+		ASSERT_NE(firstValues, parentValues);
+		ASSERT_NE(secondValues, parentValues);
+	}
+
+	TEST(RandomTest, splitCreatesIndependentEngines) {
+		expect_split_is_independent(SplitMix64Engine(RANDOM_TEST_SEED));
+		expect_split_is_independent(Xoshiro256PlusPlusEngine(RANDOM_TEST_SEED));
+		expect_split_is_independent(Xoshiro128PlusEngine(RANDOM_TEST_SEED));
+		expect_split_is_independent(Pcg32Engine(RANDOM_TEST_SEED));
+		expect_split_is_independent(Pcg64Engine(RANDOM_TEST_SEED));
+		expect_split_is_independent(Philox4x32Engine(RANDOM_TEST_SEED));
+
+		// a xoshiro child covers the subsequence its parent jumps past
+		auto parent = Xoshiro256PlusPlusEngine(RANDOM_TEST_SEED);
+		auto child = parent.split();
+		ASSERT_EQ(child.generate_array<4ULL>(),
+				  Xoshiro256PlusPlusEngine(RANDOM_TEST_SEED).generate_array<4ULL>());
+		auto jumped = Xoshiro256PlusPlusEngine(RANDOM_TEST_SEED);
+		jumped.jump();
+		ASSERT_EQ(parent.generate_array<4ULL>(), jumped.generate_array<4ULL>());
+	}
+} // namespace hyperion::math::test
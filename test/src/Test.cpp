@@ -1,10 +1,16 @@
 #include <gtest/gtest.h>
 
+#include "AutomationTest.h"
+#include "ConcurrentInterpolatorTest.h"
+#include "EnvelopeTest.h"
 #include "ExponentialsTestDouble.h"
 #include "ExponentialsTestFloat.h"
 #include "GeneralTestDouble.h"
 #include "GeneralTestFloat.h"
+#include "InterpolatorBankTest.h"
 #include "InterpolatorTest.h"
+#include "RampTableTest.h"
+#include "RandomTest.h"
 #include "TrigTestDouble.h"
 #include "TrigTestFloat.h"
 #include "Vec2Test.h"
@@ -4,6 +4,9 @@
 	#include <cmath>
 #endif
 
+#include <array>
+#include <limits>
+
 #include "HyperionMath/Trig.h"
 #include "TestConstants.h"
 #include "gtest/gtest.h"
@@ -110,4 +113,157 @@ namespace hyperion::math::test {
 		double input = -Constants<double>::piOver4;
 		ASSERT_NEAR(Trig::tanh(input), std::tanh(input), DOUBLE_ACCEPTED_ERROR);
 	}
+
+	TEST(TrigFuncsTestDouble, cosBatch) {
+		auto inputs = std::array<double, 64>();
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			inputs[i] = -20.0 + 0.625 * static_cast<double>(i);
+		}
+		auto outputs = std::array<double, 64>();
+		Trig::cos(inputs, outputs);
+
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			ASSERT_NEAR(outputs[i], std::cos(inputs[i]), DOUBLE_ACCEPTED_ERROR);
+		}
+	}
+
+	TEST(TrigFuncsTestDouble, sinBatch) {
+		auto inputs = std::array<double, 64>();
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			inputs[i] = -20.0 + 0.625 * static_cast<double>(i);
+		}
+		auto outputs = std::array<double, 64>();
+		Trig::sin(inputs, outputs);
+
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			ASSERT_NEAR(outputs[i], std::sin(inputs[i]), DOUBLE_ACCEPTED_ERROR);
+		}
+	}
+
+	TEST(TrigFuncsTestDouble, tanBatch) {
+		auto inputs = std::array<double, 64>();
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			// stay away from the asymptotes at pi/2 + n * pi
+			inputs[i] = static_cast<double>(static_cast<int>(i % 7U) - 3) * Constants<double>::pi
+						+ (-1.2 + 0.04 * static_cast<double>(i));
+		}
+		auto outputs = std::array<double, 64>();
+		Trig::tan(inputs, outputs);
+
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			ASSERT_NEAR(outputs[i], std::tan(inputs[i]), DOUBLE_ACCEPTED_ERROR);
+		}
+	}
+
+	TEST(TrigFuncsTestDouble, sincosCase1) {
+		double input = Constants<double>::pi;
+		const auto result = Trig::sincos(input);
+		ASSERT_NEAR(result.sin, std::sin(input), DOUBLE_ACCEPTED_ERROR);
+		ASSERT_NEAR(result.cos, std::cos(input), DOUBLE_ACCEPTED_ERROR);
+	}
+
+	TEST(TrigFuncsTestDouble, sincosCase2) {
+		double input = Constants<double>::piOver2;
+		const auto result = Trig::sincos(input);
+		ASSERT_NEAR(result.sin, std::sin(input), DOUBLE_ACCEPTED_ERROR);
+		ASSERT_NEAR(result.cos, std::cos(input), DOUBLE_ACCEPTED_ERROR);
+	}
+
+	TEST(TrigFuncsTestDouble, sincosCase3) {
+		double input = Constants<double>::piOver4;
+		const auto result = Trig::sincos(input);
+		ASSERT_NEAR(result.sin, std::sin(input), DOUBLE_ACCEPTED_ERROR);
+		ASSERT_NEAR(result.cos, std::cos(input), DOUBLE_ACCEPTED_ERROR);
+	}
+
+	TEST(TrigFuncsTestDouble, sincosCase4) {
+		double input = -Constants<double>::piOver4;
+		const auto result = Trig::sincos(input);
+		ASSERT_NEAR(result.sin, std::sin(input), DOUBLE_ACCEPTED_ERROR);
+		ASSERT_NEAR(result.cos, std::cos(input), DOUBLE_ACCEPTED_ERROR);
+	}
+
+	TEST(TrigFuncsTestDouble, sincosCase5) {
+		// both halves should be accurate well beyond the accepted error
+		for(auto i = -2000; i <= 2000; ++i) {
+			const auto input = 0.01 * static_cast<double>(i);
+			const auto result = Trig::sincos(input);
+			ASSERT_NEAR(result.sin, std::sin(input), 1.0e-12);
+			ASSERT_NEAR(result.cos, std::cos(input), 1.0e-12);
+		}
+	}
+
+	TEST(TrigFuncsTestDouble, sincosBatch) {
+		auto inputs = std::array<double, 64>();
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			inputs[i] = -20.0 + 0.625 * static_cast<double>(i);
+		}
+		auto sines = std::array<double, 64>();
+		auto cosines = std::array<double, 64>();
+		Trig::sincos(inputs, sines, cosines);
+
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			ASSERT_NEAR(sines[i], std::sin(inputs[i]), DOUBLE_ACCEPTED_ERROR);
+			ASSERT_NEAR(cosines[i], std::cos(inputs[i]), DOUBLE_ACCEPTED_ERROR);
+		}
+	}
+
+	TEST(TrigFuncsTestDouble, sincosBatchLargeAngles) {
+		// `angle / pi` is out of range of `int32_t` for these, so they must be clamped before
+		// the conversion; their results only need to be defined and bounded
+		const auto inputs = std::array<double, 6>{1.0e10,
+												  -1.0e10,
+												  1.0e20,
+												  -1.0e20,
+												  std::numeric_limits<double>::max(),
+												  std::numeric_limits<double>::lowest()};
+		auto sines = std::array<double, 6>();
+		auto cosines = std::array<double, 6>();
+		auto tangents = std::array<double, 6>();
+		Trig::sin(inputs, sines);
+		Trig::cos(inputs, cosines);
+		Trig::tan(inputs, tangents);
+
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			ASSERT_LE(std::abs(sines[i]), 1.0);
+			ASSERT_LE(std::abs(cosines[i]), 1.0);
+			ASSERT_FALSE(std::isnan(tangents[i]));
+			const auto result = Trig::sincos(inputs[i]);
+			ASSERT_LE(std::abs(result.sin), 1.0);
+			ASSERT_LE(std::abs(result.cos), 1.0);
+		}
+
+		// non-finite angles are clamped too, but must still produce NaN
+		const auto nonFinite = std::array<double, 3>{std::numeric_limits<double>::quiet_NaN(),
+													 std::numeric_limits<double>::infinity(),
+													 -std::numeric_limits<double>::infinity()};
+		auto nonFiniteSines = std::array<double, 3>();
+		auto nonFiniteCosines = std::array<double, 3>();
+		auto nonFiniteTangents = std::array<double, 3>();
+		Trig::sin(nonFinite, nonFiniteSines);
+		Trig::cos(nonFinite, nonFiniteCosines);
+		Trig::tan(nonFinite, nonFiniteTangents);
+
+		for(auto i = 0U; i < nonFinite.size(); ++i) {
+			ASSERT_TRUE(std::isnan(nonFiniteSines[i]));
+			ASSERT_TRUE(std::isnan(nonFiniteCosines[i]));
+			ASSERT_TRUE(std::isnan(nonFiniteTangents[i]));
+			const auto result = Trig::sincos(nonFinite[i]);
+			ASSERT_TRUE(std::isnan(result.sin));
+			ASSERT_TRUE(std::isnan(result.cos));
+		}
+	}
+
+	TEST(TrigFuncsTestDouble, sincosBatchBeyondSinglePrecision) {
+		// half turns up to 2^31 / pi are still reduced accurately in double precision
+		const auto inputs = std::array<double, 2>{1.0e9, -2.0e9};
+		auto sines = std::array<double, 2>();
+		auto cosines = std::array<double, 2>();
+		Trig::sincos(inputs, sines, cosines);
+
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			ASSERT_NEAR(sines[i], std::sin(inputs[i]), DOUBLE_ACCEPTED_ERROR);
+			ASSERT_NEAR(cosines[i], std::cos(inputs[i]), DOUBLE_ACCEPTED_ERROR);
+		}
+	}
 } // namespace hyperion::math::test
@@ -4,6 +4,9 @@
 	#include <cmath>
 #endif
 
+#include <array>
+#include <limits>
+
 #include "HyperionMath/Trig.h"
 #include "TestConstants.h"
 #include "gtest/gtest.h"
@@ -110,4 +113,134 @@ namespace hyperion::math::test {
 		float input = -Constants<>::piOver4;
 		ASSERT_NEAR(Trig::tanh(input), std::tanh(input), FLOAT_ACCEPTED_ERROR);
 	}
+
+	TEST(TrigFuncsTestFloat, cosfBatch) {
+		auto inputs = std::array<float, 64>();
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			inputs[i] = -20.0F + 0.625F * static_cast<float>(i);
+		}
+		auto outputs = std::array<float, 64>();
+		Trig::cos(inputs, outputs);
+
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			ASSERT_NEAR(outputs[i], std::cos(inputs[i]), FLOAT_ACCEPTED_ERROR);
+		}
+	}
+
+	TEST(TrigFuncsTestFloat, sinfBatch) {
+		auto inputs = std::array<float, 64>();
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			inputs[i] = -20.0F + 0.625F * static_cast<float>(i);
+		}
+		auto outputs = std::array<float, 64>();
+		Trig::sin(inputs, outputs);
+
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			ASSERT_NEAR(outputs[i], std::sin(inputs[i]), FLOAT_ACCEPTED_ERROR);
+		}
+	}
+
+	TEST(TrigFuncsTestFloat, tanfBatch) {
+		auto inputs = std::array<float, 64>();
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			// stay away from the asymptotes at pi/2 + n * pi
+			inputs[i] = static_cast<float>(static_cast<int>(i % 7U) - 3) * Constants<>::pi
+						+ (-1.2F + 0.04F * static_cast<float>(i));
+		}
+		auto outputs = std::array<float, 64>();
+		Trig::tan(inputs, outputs);
+
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			ASSERT_NEAR(outputs[i], std::tan(inputs[i]), FLOAT_ACCEPTED_ERROR);
+		}
+	}
+
+	TEST(TrigFuncsTestFloat, sincosfCase1) {
+		float input = Constants<>::pi;
+		const auto result = Trig::sincos(input);
+		ASSERT_NEAR(result.sin, std::sin(input), FLOAT_ACCEPTED_ERROR);
+		ASSERT_NEAR(result.cos, std::cos(input), FLOAT_ACCEPTED_ERROR);
+	}
+
+	TEST(TrigFuncsTestFloat, sincosfCase2) {
+		float input = Constants<>::piOver2;
+		const auto result = Trig::sincos(input);
+		ASSERT_NEAR(result.sin, std::sin(input), FLOAT_ACCEPTED_ERROR);
+		ASSERT_NEAR(result.cos, std::cos(input), FLOAT_ACCEPTED_ERROR);
+	}
+
+	TEST(TrigFuncsTestFloat, sincosfCase3) {
+		float input = Constants<>::piOver4;
+		const auto result = Trig::sincos(input);
+		ASSERT_NEAR(result.sin, std::sin(input), FLOAT_ACCEPTED_ERROR);
+		ASSERT_NEAR(result.cos, std::cos(input), FLOAT_ACCEPTED_ERROR);
+	}
+
+	TEST(TrigFuncsTestFloat, sincosfCase4) {
+		float input = -Constants<>::piOver4;
+		const auto result = Trig::sincos(input);
+		ASSERT_NEAR(result.sin, std::sin(input), FLOAT_ACCEPTED_ERROR);
+		ASSERT_NEAR(result.cos, std::cos(input), FLOAT_ACCEPTED_ERROR);
+	}
+
+	TEST(TrigFuncsTestFloat, sincosfBatch) {
+		auto inputs = std::array<float, 64>();
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			inputs[i] = -20.0F + 0.625F * static_cast<float>(i);
+		}
+		auto sines = std::array<float, 64>();
+		auto cosines = std::array<float, 64>();
+		Trig::sincos(inputs, sines, cosines);
+
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			ASSERT_NEAR(sines[i], std::sin(inputs[i]), FLOAT_ACCEPTED_ERROR);
+			ASSERT_NEAR(cosines[i], std::cos(inputs[i]), FLOAT_ACCEPTED_ERROR);
+		}
+	}
+
+	TEST(TrigFuncsTestFloat, sincosfBatchLargeAngles) {
+		// `angle / pi` is out of range of `int32_t` for these, so they must be clamped before
+		// the conversion; their results only need to be defined and bounded
+		const auto inputs = std::array<float, 6>{1.0e10F,
+												 -1.0e10F,
+												 1.0e20F,
+												 -1.0e20F,
+												 std::numeric_limits<float>::max(),
+												 std::numeric_limits<float>::lowest()};
+		auto sines = std::array<float, 6>();
+		auto cosines = std::array<float, 6>();
+		auto tangents = std::array<float, 6>();
+		Trig::sin(inputs, sines);
+		Trig::cos(inputs, cosines);
+		Trig::tan(inputs, tangents);
+
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			ASSERT_LE(std::abs(sines[i]), 1.0F);
+			ASSERT_LE(std::abs(cosines[i]), 1.0F);
+			ASSERT_FALSE(std::isnan(tangents[i]));
+			const auto result = Trig::sincos(inputs[i]);
+			ASSERT_LE(std::abs(result.sin), 1.0F);
+			ASSERT_LE(std::abs(result.cos), 1.0F);
+		}
+
+		// non-finite angles are clamped too, but must still produce NaN
+		const auto nonFinite = std::array<float, 3>{std::numeric_limits<float>::quiet_NaN(),
+													std::numeric_limits<float>::infinity(),
+													-std::numeric_limits<float>::infinity()};
+		auto nonFiniteSines = std::array<float, 3>();
+		auto nonFiniteCosines = std::array<float, 3>();
+		auto nonFiniteTangents = std::array<float, 3>();
+		Trig::sin(nonFinite, nonFiniteSines);
+		Trig::cos(nonFinite, nonFiniteCosines);
+		Trig::tan(nonFinite, nonFiniteTangents);
+
+		for(auto i = 0U; i < nonFinite.size(); ++i) {
+			ASSERT_TRUE(std::isnan(nonFiniteSines[i]));
+			ASSERT_TRUE(std::isnan(nonFiniteCosines[i]));
+			ASSERT_TRUE(std::isnan(nonFiniteTangents[i]));
+			const auto result = Trig::sincos(nonFinite[i]);
+			ASSERT_TRUE(std::isnan(result.sin));
+			ASSERT_TRUE(std::isnan(result.cos));
+		}
+	}
 } // namespace hyperion::math::test
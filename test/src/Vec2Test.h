@@ -95,6 +95,27 @@ namespace hyperion::math::test {
 		ASSERT_NEAR(vec.normalized().magnitude(), 1.0F, FLOAT_ACCEPTED_ERROR);
 	}
 
+	TEST(Vec2Test, normalizedFastFloat) {
+		auto vec = Vec2(3.5F, 5.5F);
+		ASSERT_NEAR(vec.normalized_fast().magnitude(), 1.0F, FLOAT_ACCEPTED_ERROR);
+	}
+
+	TEST(Vec2Test, normalizedFastDouble) {
+		auto vec = Vec2(3.5, 5.5);
+		ASSERT_NEAR((vec.normalized_fast<double, 4>().magnitude<double>()), 1.0, 1.0E-10);
+	}
+
+	TEST(Vec2Test, normalizedFastDoubleDefault) {
+		// the default number of Newton steps should give full double precision
+		auto vec = Vec2(3.5, 5.5);
+		ASSERT_NEAR((vec.normalized_fast<double>().magnitude<double>()), 1.0, 1.0E-10);
+	}
+
+	TEST(Vec2Test, normalizedFastInt) {
+		auto vec = Vec2(3, 5);
+		ASSERT_NEAR(vec.normalized_fast().magnitude(), 1.0F, FLOAT_ACCEPTED_ERROR);
+	}
+
 	TEST(Vec2Test, opNegative) {
 		auto vec = Vec2(3, 5);
 		ASSERT_EQ(-vec, Vec2(-3, -5));
@@ -95,6 +95,27 @@ namespace hyperion::math::test {
 		ASSERT_NEAR(vec.normalized().magnitude(), 1.0F, FLOAT_ACCEPTED_ERROR);
 	}
 
+	TEST(Vec3Test, normalizedFastFloat) {
+		auto vec = Vec3(3.5F, 5.5F, 7.5F);
+		ASSERT_NEAR(vec.normalized_fast().magnitude(), 1.0F, FLOAT_ACCEPTED_ERROR);
+	}
+
+	TEST(Vec3Test, normalizedFastDouble) {
+		auto vec = Vec3(3.5, 5.5, 7.5);
+		ASSERT_NEAR((vec.normalized_fast<double, 4>().magnitude<double>()), 1.0, 1.0E-10);
+	}
+
+	TEST(Vec3Test, normalizedFastDoubleDefault) {
+		// the default number of Newton steps should give full double precision
+		auto vec = Vec3(3.5, 5.5, 7.5);
+		ASSERT_NEAR((vec.normalized_fast<double>().magnitude<double>()), 1.0, 1.0E-10);
+	}
+
+	TEST(Vec3Test, normalizedFastInt) {
+		auto vec = Vec3(3, 5, 7);
+		ASSERT_NEAR(vec.normalized_fast().magnitude(), 1.0F, FLOAT_ACCEPTED_ERROR);
+	}
+
 	TEST(Vec3Test, opNegative) {
 		auto vec = Vec3(3, 5, 7);
 		ASSERT_EQ(-vec, Vec3<int>(-3, -5, -7));